@@ -0,0 +1,32 @@
+/*
+
+    Benchmark.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Benchmark hooks compile to nothing unless BENCHMARK is defined
+//
+#ifdef BENCHMARK
+#define BENCH(x) x
+#else
+#define BENCH(x)
+#endif
+
+#define BENCH_REPORT 10000                    // ms between serial reports
+#define BENCH_LOOKUPS 1000                    // cache lookups timed at each cache size
+#ifndef BENCH_FUZZ
+#define BENCH_FUZZ 10000                      // random request lines parsed, more on the host, see SolisHost/Makefile
+#endif
+#define BENCH_PARSES 1000                     // dashboard request lines timed
+
+//  Running min/mean/max of a measurement
+//
+struct benchStat {
+    unsigned long count;
+    unsigned long total;
+    unsigned long low;
+    unsigned long high;
+};
@@ -0,0 +1,202 @@
+/*
+
+    Benchmark
+    https://github.com/RichardL64
+
+    End to end timing of the poll loop and web server, built with BENCHMARK defined
+    Reports to serial every BENCH_REPORT ms then starts again
+
+      loop        us per loop() pass - how long a client or modbus request can be kept waiting
+      refresh     ms between reads of a register from the inverter
+      fresh       ms age of the values returned to /R clients
+      requests    HTTP requests served per second
+
+    At startup the register cache lookup cost is measured as the cache fills, it should stay flat
+    up to CACHE_SIZE - the host build sweeps to 1000 registers
+    and the request line parser is fed random lines, any pointer outside the line is counted, then timed
+
+
+    Pair with SIMULATE_INVERTER to run on a bare board, load with N simulated dashboards e.g.
+
+      for i in 1 2 3 4; do (while true; do curl -s "http://solis.local/R?address=33057.2,33035" >/dev/null; done) & done
+
+    Or run on Linux with no board at all, see SolisHost - make -C SolisHost run
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#ifdef BENCHMARK
+
+benchStat benchLoops, benchRefreshes, benchFresh;
+unsigned long benchRequests;
+unsigned long benchStart;
+
+//  Time cache lookups at increasing numbers of cached registers
+//  Leaves the cache empty
+//
+void benchLookup() {
+  const int sizes[] = {8, 16, 32, 64, 100, 250, 500, 1000};
+
+  Serial.println(F("Lookup ns/register"));
+  for(unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    int n = min(sizes[s], CACHE_SIZE);
+    stopAll();
+    for(int a = 0; a < n; a++) registerIndex(33000 + a *3);
+
+    unsigned long start = micros();
+    for(int r = 0; r < BENCH_LOOKUPS; r++) getRegister(33000 + r % n *3, 1);
+    unsigned long elapsed = micros() - start;
+
+    Serial.print(" ");
+    Serial.print(n);
+    Serial.print(" = ");
+    Serial.println(elapsed * 1000 / BENCH_LOOKUPS);
+    if(n == CACHE_SIZE) break;
+  }
+  stopAll();
+}
+
+//  Fuzz the request parser, then time a typical dashboard request
+//
+void benchParse() {
+  static httpConnection conn;                       // scratch, not a client slot
+  httpRequest req;
+  const char *list;
+  int address, size;
+  unsigned long interval;
+
+  Serial.print(F("Parse fuzz "));
+  Serial.print(BENCH_FUZZ);
+  Serial.print(F(" lines, out of bounds "));
+  Serial.println(benchFuzz(BENCH_FUZZ));
+
+  unsigned long start = micros();
+  for(int r = 0; r < BENCH_PARSES; r++) {
+    strcpy(conn.line, "GET /R?lease=60&address=33057.2,33035@60s,33139,33149.2,33135,2:33057.2 HTTP/1.1");
+    httpParse(conn, req);
+    httpNumber(req, "lease");
+    list = httpParam(req, "address");
+    while(nextAddress(list, address, size, interval));
+  }
+  unsigned long elapsed = micros() - start;
+
+  Serial.print(F("Parse ns/request "));
+  Serial.println(elapsed * 1000 / BENCH_PARSES);
+}
+
+//  Split random request lines, stepping through their parameters, aliases and address lists
+//  Returns the number of times a part stepped outside the line
+//
+int benchFuzz(long lines) {
+  static httpConnection conn;                       // scratch, not a client slot
+  const char alphabet[] = "GET /R?&=,.:@ms0123456789address";
+  httpRequest req;
+  const char *list;
+  int address, size;
+  unsigned long interval;
+
+  int bad = 0;
+  for(long f = 0; f < lines; f++) {
+    int l = random(HTTP_LINE_SIZE);
+    for(int c = 0; c < l; c++) conn.line[c] = alphabet[random(sizeof(alphabet) -1)];
+    if(f % 2 == 0 && l > 7) memcpy(conn.line, "GET /R?", 7);   // half with a query
+    conn.line[l] = '\0';
+    httpParse(conn, req);
+    req.aliases = "a:address s:since l:lease";
+
+    const char *end = conn.line + l;
+    if(req.path < conn.line || req.end < req.path || req.end > end || req.params > HTTP_PARAMS) bad++;
+    for(int n = 0; n < req.params; n++) {
+      if(req.param[n] < req.path || req.param[n] >= req.end) bad++;
+    }
+    int steps = 0;
+    list = httpParam(req, "address");
+    while(steps <= l && nextAddress(list, address, size, interval)) steps++;
+    if(steps > l || (list != 0 && (list < conn.line || list > end))) bad++;
+
+    const char *since = httpParam(req, "since");
+    if(since != 0 && (since < req.path || since > req.end)) bad++;
+  }
+  return bad;
+}
+
+//  Add a measurement
+//
+void benchAdd(benchStat &stat, unsigned long value) {
+  if(stat.count == 0 || value < stat.low) stat.low = value;
+  if(value > stat.high) stat.high = value;
+  stat.total += value;
+  stat.count++;
+}
+
+//  Called at the top of every loop
+//  Times the previous pass and reports periodically
+//
+void benchLoop() {
+  static unsigned long last;
+  unsigned long now = micros();
+  if(last != 0) benchAdd(benchLoops, now - last);
+  last = now;
+
+  if(millis() - benchStart > BENCH_REPORT) {
+    benchReport();
+    last = micros();                                // don't count the report itself
+  }
+}
+
+//  Called with the time since a register was last read
+//
+void benchRefresh(unsigned long ms) {
+  benchAdd(benchRefreshes, ms);
+}
+
+//  Called with the age of each value returned to a client
+//
+void benchFreshness(unsigned long age) {
+  benchAdd(benchFresh, age);
+}
+
+//  Called for each HTTP request
+//
+void benchRequest() {
+  benchRequests++;
+}
+
+//  Output the stats so far and reset
+//
+void benchReport() {
+  unsigned long elapsed = millis() - benchStart;
+
+  Serial.println(F("Benchmark"));
+  benchPrint("loop us", benchLoops);
+  benchPrint("refresh ms", benchRefreshes);
+  benchPrint("fresh ms", benchFresh);
+  Serial.print(F(" requests/s "));
+  Serial.println(benchRequests * 1000.0 / elapsed);
+
+  benchLoops = benchRefreshes = benchFresh = {0, 0, 0, 0};
+  benchRequests = 0;
+  benchStart = millis();
+}
+
+//  name n=<count> min/mean/max
+//
+void benchPrint(const char *name, benchStat &stat) {
+  Serial.print(" ");
+  Serial.print(name);
+  Serial.print(F(" n="));
+  Serial.print(stat.count);
+  if(stat.count == 0) {
+    Serial.println();
+    return;
+  }
+  Serial.print(" ");
+  Serial.print(stat.low);
+  Serial.print("/");
+  Serial.print(stat.total / stat.count);
+  Serial.print("/");
+  Serial.println(stat.high);
+}
+
+#endif
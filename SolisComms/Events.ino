@@ -0,0 +1,128 @@
+/*
+
+    Events
+    https://github.com/RichardL64
+
+    Server-Sent Events push of register values to clients holding a connection open
+
+      /events?address=<value>,<value>...
+
+    After each poll cycle every stream with a register changed since its last send gets the same JSON as /R,
+    from the same Snapshot. All streams share the same reads, nothing is sent when nothing changed
+    An alive event every EVENT_ALIVE ms tells the client the data is current, and finds dropped connections
+
+      data: {"cycle":57,"data":[1, 100, 262]}
+
+      event: alive
+      data:
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Start an event stream for the listed addresses
+//  The current values are sent straight away
+//
+void eventsSubscribe(httpConnection &conn, const char *list) {
+  int streams = 0;
+  for(int c = 0; c < HTTP_CONNECTIONS; c++) {
+    if(connections[c].state == CONN_EVENTS) streams++;
+  }
+  if(streams >= EVENT_CONNECTIONS) {
+    httpError(conn.client, "503 Service Unavailable");
+    return;
+  }
+
+  conn.events = 0;
+  int address, size;
+  unsigned long interval;
+  while(conn.events < EVENT_ADDRESSES && nextAddress(list, address, size, interval)) {
+    int i = registerIndex(address, size);
+    if(i == -1) {                                   // cache full of registers in use
+      httpError(conn.client, "503 Service Unavailable");
+      return;
+    }
+    registerInterval(i, interval);
+
+    conn.eventAddress[conn.events] = address;
+    conn.eventSize[conn.events] = size;
+    conn.events++;
+  }
+
+  HttpWriter out(conn.client);
+  out.print(F("HTTP/1.1 200 OK\r\n"
+              "Content-Type: text/event-stream\r\n"
+              "Cache-Control: no-cache\r\n"
+              "Access-Control-Allow-Origin: *\r\n\r\n"));
+  out.flush();
+
+  conn.state = CONN_EVENTS;
+  eventsChanged(conn);                              // add to the cache
+  eventsSend(conn);
+}
+
+//  Called at the end of each poll cycle
+//  Push to every stream with a changed register
+//
+void eventsPush() {
+  for(int c = 0; c < HTTP_CONNECTIONS; c++) {
+    httpConnection &conn = connections[c];
+    if(conn.state != CONN_EVENTS) continue;
+    if(eventsChanged(conn)) eventsSend(conn);
+  }
+}
+
+//  Keep an open stream alive, close it when the client goes away
+//  Anything the client sends is ignored
+//
+void eventsService(httpConnection &conn) {
+  char buffer[HTTP_READ_CHUNK];
+  while(conn.client.available() > 0) conn.client.read((uint8_t *)buffer, HTTP_READ_CHUNK);
+
+  if(!conn.client.connected()) {
+    httpClose(conn);
+    return;
+  }
+
+  if(millis() - conn.lastEvent > EVENT_ALIVE) {
+    conn.client.print(F("event: alive\ndata:\n\n"));
+    conn.lastEvent = millis();
+  }
+}
+
+//  True if any stream register has changed in the snapshot since the last send
+//  Every check counts as a request - keeps the registers in the cache
+//
+bool eventsChanged(httpConnection &conn) {
+  bool changed = false;
+  for(int e = 0; e < conn.events; e++) {
+    int i = registerIndex(conn.eventAddress[e], conn.eventSize[e]);
+    if(i == -1) continue;
+    cacheTouch(i);
+    snapshotValue *s = snapshotFind(conn.eventAddress[e]);
+    if(s != 0 && s->version > conn.eventSequence) changed = true;
+  }
+  return changed;
+}
+
+//  Send the stream registers as a data event
+//
+void eventsSend(httpConnection &conn) {
+  HttpWriter out(conn.client);
+  out.print(F("data: {\"cycle\":"));
+  out.print(snapshot.cycle);
+  out.print(F(",\"data\":["));
+
+  for(int e = 0; e < conn.events; e++) {
+    int i = registerIndex(conn.eventAddress[e], conn.eventSize[e]);
+    snapshotValue *s = snapshotFind(conn.eventAddress[e]);
+    if(e > 0) out.write(',');
+    if(i == -1) out.print("null");
+    else out.writeLong(s == 0 ? 0 : s->value);
+  }
+
+  out.print(F("]}\n\n"));
+  out.flush();
+  conn.lastEvent = millis();
+  conn.eventSequence = snapshot.sequence;
+}
@@ -0,0 +1,53 @@
+/*
+
+    Expression.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define EXPR_INPUTS 4                         // registers one expression can read
+#define EXPR_CODE 32                          // bytecode bytes
+#define EXPR_STACK 8                          // evaluation stack depth
+
+//  Bytecode, reverse polish
+//
+#define OP_END 0
+#define OP_CONST 1                            // + 4 byte little endian long
+#define OP_BYTE 2                             // + 1 byte constant 0..255
+#define OP_INPUT 3                            // + input number, the register value
+#define OP_ADD 4
+#define OP_SUB 5
+#define OP_MUL 6
+#define OP_DIV 7                              // divide by 0 = 0
+#define OP_NEG 8
+#define OP_MIN 9
+#define OP_MAX 10
+#define OP_LT 11                              // comparisons and logic give 1 or 0
+#define OP_LE 12
+#define OP_GT 13
+#define OP_GE 14
+#define OP_EQ 15
+#define OP_NE 16
+#define OP_AND 17
+#define OP_OR 18
+
+//  A compiled expression and the registers it reads
+//
+struct expression {
+    byte inputs;
+    int input[EXPR_INPUTS];                   // register addresses
+    byte size[EXPR_INPUTS];                   // 1 or 2 registers
+    byte code[EXPR_CODE];
+};
+
+//  Compiler state
+//
+struct exprParser {
+    const char *p;                            // next char
+    expression *e;
+    int length;                               // code bytes written
+    int depth;                                // stack depth at this point
+    bool ok;
+};
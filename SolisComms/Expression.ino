@@ -0,0 +1,267 @@
+/*
+
+    Expression
+    https://github.com/RichardL64
+
+    Small integer expressions over cached registers, compiled once to reverse polish bytecode
+
+      r33139 r33149.2 r2:33139  register value, .2 for a double register, device: on another device
+      123                       constant
+      + - * / ( ) -x            integer arithmetic, divide by 0 gives 0
+      min(a,b) max(a,b)
+      < <= > >= == !=           comparisons, 1 true or 0 false
+      and or                    non zero is true, lowest precedence
+
+    e.g. max(r33303*100-1400,0)*60/max(-r33305,0)
+         r33139>=95 and r33057.2>=100
+
+    Spaces are skipped, but end the URL in a request line so can only be used in built in definitions.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Compile text into e
+//  Returns false on a syntax error, too many inputs or too long
+//
+bool exprCompile(const char *text, expression &e) {
+  memset(&e, 0, sizeof(e));
+  exprParser ps = {text, &e, 0, 0, true};
+
+  exprOr(ps);
+  if(exprPeek(ps) != '\0') ps.ok = false;               // trailing junk
+  exprEmit(ps, OP_END, 0);
+  return ps.ok;
+}
+
+//  or := and (or and)...
+//
+void exprOr(exprParser &ps) {
+  exprAnd(ps);
+  while(ps.ok && exprWord(ps, "or")) {
+    exprAnd(ps);
+    exprEmit(ps, OP_OR, -1);
+  }
+}
+
+//  and := compare (and compare)...
+//
+void exprAnd(exprParser &ps) {
+  exprCompare(ps);
+  while(ps.ok && exprWord(ps, "and")) {
+    exprCompare(ps);
+    exprEmit(ps, OP_AND, -1);
+  }
+}
+
+//  compare := sum [< <= > >= == != sum]
+//
+void exprCompare(exprParser &ps) {
+  exprSum(ps);
+
+  char c = exprPeek(ps);
+  char c2 = c == '\0' ? '\0' : ps.p[1];
+  byte op;
+  if(c == '<') op = c2 == '=' ? OP_LE : OP_LT;
+  else if(c == '>') op = c2 == '=' ? OP_GE : OP_GT;
+  else if(c == '=' && c2 == '=') op = OP_EQ;
+  else if(c == '!' && c2 == '=') op = OP_NE;
+  else return;                                          // just a sum
+
+  ps.p += (c2 == '=') ? 2 : 1;
+  exprSum(ps);
+  exprEmit(ps, op, -1);
+}
+
+//  sum := product (+|- product)...
+//
+void exprSum(exprParser &ps) {
+  exprProduct(ps);
+  while(ps.ok && (exprPeek(ps) == '+' || *ps.p == '-')) {
+    byte op = *ps.p++ == '+' ? OP_ADD : OP_SUB;
+    exprProduct(ps);
+    exprEmit(ps, op, -1);
+  }
+}
+
+//  product := unary (*|/ unary)...
+//
+void exprProduct(exprParser &ps) {
+  exprUnary(ps);
+  while(ps.ok && (exprPeek(ps) == '*' || *ps.p == '/')) {
+    byte op = *ps.p++ == '*' ? OP_MUL : OP_DIV;
+    exprUnary(ps);
+    exprEmit(ps, op, -1);
+  }
+}
+
+//  unary := -unary | primary
+//
+void exprUnary(exprParser &ps) {
+  if(exprPeek(ps) == '-') {
+    ps.p++;
+    exprUnary(ps);
+    exprEmit(ps, OP_NEG, 0);
+    return;
+  }
+  exprPrimary(ps);
+}
+
+//  primary := number | r<address>[.2] | min(sum,sum) | max(sum,sum) | (sum)
+//
+void exprPrimary(exprParser &ps) {
+  if(!ps.ok) return;
+  exprPeek(ps);
+
+  if(isdigit(*ps.p)) {                                  // constant
+    char *end;
+    unsigned long value = strtoul(ps.p, &end, 10);
+    ps.p = end;
+    if(value <= 255) {
+      exprEmit(ps, OP_BYTE, 1);
+      exprByte(ps, value);
+    } else {
+      exprEmit(ps, OP_CONST, 1);
+      for(int b = 0; b < 4; b++, value >>= 8) exprByte(ps, value);
+    }
+    return;
+  }
+
+  if(*ps.p == 'r' && isdigit(ps.p[1])) {                // register
+    int size;
+    unsigned long interval;
+    char *end;
+    int address = parseAddress(ps.p +1, size, interval);
+    if(address == ADDRESS_INVALID) {
+      ps.ok = false;
+      return;
+    }
+    strtol(ps.p +1, &end, 10);                          // skip the address and any :address .size
+    if(*end == ':') strtol(end +1, &end, 10);
+    if(*end == '.') strtol(end +1, &end, 10);
+    ps.p = end;
+
+    expression &e = *ps.e;
+    int n = 0;
+    while(n < e.inputs && e.input[n] != address) n++;
+    if(n == e.inputs) {                                 // new input
+      if(n == EXPR_INPUTS) {
+        ps.ok = false;
+        return;
+      }
+      e.input[n] = address;
+      e.size[n] = size;
+      e.inputs++;
+    }
+    exprEmit(ps, OP_INPUT, 1);
+    exprByte(ps, n);
+    return;
+  }
+
+  if(strncmp(ps.p, "min(", 4) == 0 || strncmp(ps.p, "max(", 4) == 0) {
+    byte op = ps.p[1] == 'i' ? OP_MIN : OP_MAX;
+    ps.p += 4;
+    exprOr(ps);
+    exprExpect(ps, ',');
+    exprOr(ps);
+    exprExpect(ps, ')');
+    exprEmit(ps, op, -1);
+    return;
+  }
+
+  if(*ps.p == '(') {
+    ps.p++;
+    exprOr(ps);
+    exprExpect(ps, ')');
+    return;
+  }
+
+  ps.ok = false;                                        // anything else
+}
+
+//  Step over an expected char
+//
+void exprExpect(exprParser &ps, char c) {
+  if(exprPeek(ps) == c) ps.p++;
+  else ps.ok = false;
+}
+
+//  Skip spaces, returning the next char
+//
+char exprPeek(exprParser &ps) {
+  while(*ps.p == ' ') ps.p++;
+  return *ps.p;
+}
+
+//  Step over a keyword if it's next
+//
+bool exprWord(exprParser &ps, const char *word) {
+  int l = strlen(word);
+  if(exprPeek(ps) != word[0] || strncmp(ps.p, word, l) != 0) return false;
+  ps.p += l;
+  return true;
+}
+
+//  Write an op, tracking the stack depth it leaves
+//
+void exprEmit(exprParser &ps, byte op, int stack) {
+  ps.depth += stack;
+  if(ps.depth > EXPR_STACK) ps.ok = false;
+  exprByte(ps, op);
+}
+
+void exprByte(exprParser &ps, byte b) {
+  if(ps.length == EXPR_CODE) {
+    ps.ok = false;
+    return;
+  }
+  ps.e->code[ps.length++] = b;
+}
+
+//  Run the bytecode on the cached input values
+//  Returns the state, STATE_VALID with the result or the state of the first input without valid data
+//
+int exprEvaluate(expression &e, long &result) {
+  long value[EXPR_INPUTS];
+  for(int n = 0; n < e.inputs; n++) {
+    int i = cacheFind(e.input[n]);
+    if(i == -1) return STATE_NULL;
+    if(regCache[i].state != STATE_VALID) return regCache[i].state;
+    value[n] = regCache[i].value;
+  }
+
+  long stack[EXPR_STACK];
+  int sp = 0;
+  for(byte *pc = e.code; ; ) {
+    switch(*pc++) {
+      case OP_END:
+        result = sp > 0 ? stack[sp -1] : 0;
+        return STATE_VALID;
+
+      case OP_CONST: {
+        unsigned long c = 0;
+        for(int b = 0; b < 4; b++) c |= (unsigned long)*pc++ << (8 * b);
+        stack[sp++] = c;
+        break;
+      }
+      case OP_BYTE:  stack[sp++] = *pc++; break;
+      case OP_INPUT: stack[sp++] = value[*pc++]; break;
+      case OP_NEG:   stack[sp -1] = -stack[sp -1]; break;
+
+      case OP_ADD: sp--; stack[sp -1] += stack[sp]; break;
+      case OP_SUB: sp--; stack[sp -1] -= stack[sp]; break;
+      case OP_MUL: sp--; stack[sp -1] *= stack[sp]; break;
+      case OP_DIV: sp--; stack[sp -1] = stack[sp] == 0 ? 0 : stack[sp -1] / stack[sp]; break;
+      case OP_MIN: sp--; stack[sp -1] = min(stack[sp -1], stack[sp]); break;
+      case OP_MAX: sp--; stack[sp -1] = max(stack[sp -1], stack[sp]); break;
+      case OP_LT:  sp--; stack[sp -1] = stack[sp -1] < stack[sp]; break;
+      case OP_LE:  sp--; stack[sp -1] = stack[sp -1] <= stack[sp]; break;
+      case OP_GT:  sp--; stack[sp -1] = stack[sp -1] > stack[sp]; break;
+      case OP_GE:  sp--; stack[sp -1] = stack[sp -1] >= stack[sp]; break;
+      case OP_EQ:  sp--; stack[sp -1] = stack[sp -1] == stack[sp]; break;
+      case OP_NE:  sp--; stack[sp -1] = stack[sp -1] != stack[sp]; break;
+      case OP_AND: sp--; stack[sp -1] = stack[sp -1] && stack[sp]; break;
+      case OP_OR:  sp--; stack[sp -1] = stack[sp -1] || stack[sp]; break;
+    }
+  }
+}
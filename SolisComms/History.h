@@ -0,0 +1,52 @@
+/*
+
+    History.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define HISTORY_CACHE_SIZE 12                 // addresses with history kept, ~1.2KB RAM each
+
+#define FIVE_MINUTE 0                         // history tiers
+#define ONE_HOUR 1
+#define ONE_DAY 2
+#define HISTORY_TIERS 3
+
+#define HISTORY_POINT_MAX 15                  // encoded bytes of a point at worst, 32 bit values 3 x 5 byte varints
+#define HISTORY_MINUTE_BYTES 768              // ring buffer bytes per address per tier, points at 3 steady to HISTORY_POINT_MAX bytes
+#define HISTORY_HOUR_BYTES 160
+#define HISTORY_DAY_BYTES 96
+#define HISTORY_BYTES (HISTORY_MINUTE_BYTES + HISTORY_HOUR_BYTES + HISTORY_DAY_BYTES)
+
+#if HISTORY_DAY_BYTES < HISTORY_POINT_MAX || HISTORY_HOUR_BYTES < HISTORY_POINT_MAX || HISTORY_MINUTE_BYTES < HISTORY_POINT_MAX
+#error "Every history ring must hold at least one point"
+#endif
+
+//  One tier of history for an address
+//  The running aggregate for the current period, and a ring buffer of closed periods
+//
+struct historyTier {
+    unsigned long start;                      // millis current period started
+    long low;                                 // running aggregate
+    long high;
+    int64_t total;
+    unsigned long count;
+
+    long base;                                // mean before the oldest point - deltas start here
+    long last;                                // mean of the newest point
+    word first;                               // ring offset of the oldest point
+    word used;                                // ring bytes used
+    word points;                              // points in the ring
+    unsigned long closed;                     // millis the newest point closed
+};
+
+//  History retention instructions and data
+//
+struct {
+  int address;
+  bool keep[HISTORY_TIERS];                   // tiers requested
+  historyTier tier[HISTORY_TIERS];
+  byte data[HISTORY_BYTES];                   // ring buffers, tier after tier
+} histCache[HISTORY_CACHE_SIZE];
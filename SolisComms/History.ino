@@ -4,94 +4,265 @@
     https://github.com/RichardL64
     
     Manage collection of historic data
-    Initially to Arduino RAM in cyclical buffers
-    Potential to expand to external SD
-        
-    R.A.Lincoln       July 2022
+    Arduino RAM in cyclical buffers, kept across power cuts by Store
 
-*/
+    Every sample of a kept address updates a running min/max/mean for the current 5 minute, hour and day.
+    At the end of each period the aggregate is closed into that tier's ring buffer, oldest points dropped to make room.
+    Values are in the register's own fixed point units, the mean rounded.
 
-#define HISTORY_CACHE_SIZE 20
+    Points are delta encoded as variable length integers, 1 byte per 7 bits:
+      zigzag(mean - previous mean), mean - min, max - mean
+    so a steady register costs 3 bytes a point, a busy power register around 6, at worst 15 for a 32 bit register.
 
-#define FIVE_MINUTE 0;
-#define ONE_HOUR 1;
-#define ONE_DAY 2;
+    RAM holds 12 addresses, too few bytes to promise a day at worst for all of them.
+    The 768 byte 5 minute ring keeps a day of a steady register, about 10 hours of a busy power register,
+    and at least 51 points, over 4 hours, of a 32 bit register jumping by large amounts. The oldest points go first.
 
-//  History retention instructions
-//
-struct {
-  int address;
-  bool fiveMinute;
-  bool oneHour;
-  bool oneDay;
-} histCache[HISTORY_CACHE_SIZE];
+    R.A.Lincoln       July 2022
 
+*/
+
+const unsigned long historyPeriod[HISTORY_TIERS] = {5 * 60000UL, 60 * 60000UL, 24 * 60 * 60000UL};
+const word historyOffset[HISTORY_TIERS +1] = {0, HISTORY_MINUTE_BYTES,
+                                              HISTORY_MINUTE_BYTES + HISTORY_HOUR_BYTES, HISTORY_BYTES};
+const char historyRange[HISTORY_TIERS] = {'m', 'h', 'd'};
 
 //  Record a address/value pair
 //
 void setHistory(int address, long value) {
+  int h = historyIndex(address);
+  if(h == -1) return;                                         // not kept
 
-  for(int i = 0; i< HISTORY_CACHE_SIZE; i++) {               // exists already?
-    if(histCache[i].address == address) {
-
-      //  Maintain a moving average
-      //
-/*      
-      //  Check for writing out a data point
-      //
-      if(histCache[i].fiveMinute
-      && its 5 minutes) {
-        
-      }
-      if(histCache[i].oneHour
-      && its on the hour) {
-        
-      }
-      if(histCache[i].oneDay
-      && its midnight?) {
-        
-      }
-*/
-      break;
+  for(int t = 0; t < HISTORY_TIERS; t++) {
+    historyTier &tier = histCache[h].tier[t];
+    if(tier.count == 0 || value < tier.low) tier.low = value;
+    if(tier.count == 0 || value > tier.high) tier.high = value;
+    tier.total += value;
+    tier.count++;
+  }
+}
+
+//  Close any periods that have ended
+//  Kept registers are pinned in the register cache, found without counting as a client lookup
+//  Called from the main loop
+//
+void historyTick() {
+  unsigned long now = millis();
+
+  for(int h = 0; h < HISTORY_CACHE_SIZE; h++) {
+    if(histCache[h].address == 0) continue;
+    registerPin(registerOwn(histCache[h].address));      // -1 ignored with the cache full
+
+    for(int t = 0; t < HISTORY_TIERS; t++) {
+      historyTier &tier = histCache[h].tier[t];
+      if(now - tier.start < historyPeriod[t]) continue;
+
+      tier.start += historyPeriod[t];
+      if(now - tier.start >= historyPeriod[t]) tier.start = now;  // missed periods - restart
+
+      if(histCache[h].keep[t]) historyClose(h, t);
+      tier.count = 0;
+      tier.total = 0;
     }
   }
 }
 
 //  New instruction to keep history records
 //  Store in a file for future reference and globally for collection now
+//  Tiers are fixed periods, freq and keep are for the future
 //
 void keepHistory(char range, int freq, int keep, int address) {
+  int h = historySlot(address);
+  if(h == -1) return;                                     // full
 
-  for(int i = 0; i < HISTORY_CACHE_SIZE; i++) {           // exists already?
-    if(histCache[i].address == address) {
-      if(range == 'm') histCache[i].fiveMinute = true;    
-      if(range == 'h') histCache[i].oneHour = true;    
-      if(range == 'd') histCache[i].oneDay = true;    
-      saveHistCache;                                    // save to file
-      return;
-    }
+  for(int t = 0; t < HISTORY_TIERS; t++) {
+    if(range == historyRange[t]) histCache[h].keep[t] = true;
   }
+  saveHistCache();                                        // save to file
+}
+
+//  Return the history index for the address, adding it to an empty slot if new
+//  -1 if full
+//
+int historySlot(int address) {
+  int h = historyIndex(address);                          // exists already?
+  if(h != -1) return h;
 
-  for(int i = 0; i < HISTORY_CACHE_SIZE; i++) {          // add to an empty slot
+  for(int i = 0; i < HISTORY_CACHE_SIZE; i++) {           // add to an empty slot
     if(histCache[i].address == 0) {
+      memset(&histCache[i], 0, sizeof(histCache[i]));
       histCache[i].address = address;
-      if(range == 'm') histCache[i].fiveMinute = true;    
-      if(range == 'h') histCache[i].oneHour = true;    
-      if(range == 'd') histCache[i].oneDay = true;    
-      saveHistCache;                                    // save to file
-      return;
+      for(int t = 0; t < HISTORY_TIERS; t++) histCache[i].tier[t].start = millis();
+      return i;
     }
   }
+  return -1;
 }
 
-//  Save the history instruction information to file
+//  Return the history index for the address, or -1 if not kept
 //
-void saveHistCache() {
-  
+int historyIndex(int address) {
+  for(int h = 0; h < HISTORY_CACHE_SIZE; h++) {
+    if(histCache[h].address == address) return h;
+  }
+  return -1;
+}
+
+//  Return the tier for a range character m, h, d or -1
+//
+int historyTierIndex(char range) {
+  for(int t = 0; t < HISTORY_TIERS; t++) {
+    if(range == historyRange[t]) return t;
+  }
+  return -1;
+}
+
+//  Close the current period into the ring buffer
+//  With no samples the previous point is repeated
+//
+void historyClose(int h, int t) {
+  historyTier &tier = histCache[h].tier[t];
+
+  long mean = tier.last, low = tier.last, high = tier.last;
+  if(tier.count > 0) {
+    mean = (tier.total + (int64_t)tier.count / 2) / (int64_t)tier.count;
+    low = tier.low;
+    high = tier.high;
+  }
+
+  historyStore(h, t, mean, low, high);
+  storePoint(h, t, mean, low, high);                      // batched to file
+}
+
+//  Add a point to the ring buffer, dropping the oldest to make room
+//
+void historyStore(int h, int t, long mean, long low, long high) {
+  historyTier &tier = histCache[h].tier[t];
+
+  byte point[3 * (sizeof(long) * 8 / 7 +1)];              // 3 varints max
+  int n = historyEncode(point, historyZigzag((unsigned long)mean - tier.last));
+  n += historyEncode(point + n, (unsigned long)mean - low);
+  n += historyEncode(point + n, (unsigned long)high - mean);
+
+  word size = historyOffset[t +1] - historyOffset[t];
+  while(size - tier.used < n) historyDrop(h, t);
+
+  word pos = (tier.first + tier.used) % size;
+  for(int i = 0; i < n; i++) {
+    histCache[h].data[historyOffset[t] + pos] = point[i];
+    pos = (pos +1) % size;
+  }
+
+  tier.used += n;
+  tier.points++;
+  tier.last = mean;
+  tier.closed = millis();
+}
+
+//  Drop the oldest point, the next oldest becomes relative to the new base
+//
+void historyDrop(int h, int t) {
+  historyTier &tier = histCache[h].tier[t];
+  word size = historyOffset[t +1] - historyOffset[t];
+
+  word pos = tier.first;
+  tier.base = (unsigned long)tier.base + historyUnzigzag(historyDecode(h, t, pos));
+  historyDecode(h, t, pos);
+  historyDecode(h, t, pos);
+
+  tier.used -= (pos + size - tier.first) % size;
+  tier.first = pos;
+  tier.points--;
+}
+
+//  Stream a tier of points oldest first as JSON, [mean, min, max]
+//  age is seconds since the newest point closed
+//
+//  {"address":33057,"range":"m","period":300,"age":12,"data":[[1200,900,1500],[1350,1100,1600]]}
+//
+void historyJSON(int address, char range, int count, HttpWriter &out) {
+  int h = historyIndex(address);
+  int t = historyTierIndex(range);
+
+  out.print(F("{\"address\":"));
+  out.writeLong(address);
+  out.print(F(",\"range\":\""));
+  out.write(range);
+  out.print(F("\",\"period\":"));
+  out.writeLong(t == -1 ? 0 : historyPeriod[t] / 1000);
+
+  if(h == -1 || t == -1) {
+    out.print(F(",\"data\":[]}"));
+    return;
+  }
+
+  historyTier &tier = histCache[h].tier[t];
+  out.print(F(",\"age\":"));
+  out.writeLong((millis() - tier.closed) / 1000);
+  out.print(F(",\"data\":["));
+
+  int skip = (count > 0 && count < tier.points) ? tier.points - count : 0;
+  word pos = tier.first;
+  long mean = tier.base;
+  for(int p = 0; p < tier.points; p++) {
+    mean = (unsigned long)mean + historyUnzigzag(historyDecode(h, t, pos));
+    long low = (unsigned long)mean - historyDecode(h, t, pos);
+    long high = (unsigned long)mean + historyDecode(h, t, pos);
+    if(p < skip) continue;
+
+    if(p > skip) out.write(',');
+    out.write('[');
+    out.writeLong(mean);
+    out.write(',');
+    out.writeLong(low);
+    out.write(',');
+    out.writeLong(high);
+    out.write(']');
+  }
+  out.print("]}");
+}
+
+//  Write a variable length unsigned integer, 7 bits per byte, low bits first
+//  Returns the bytes written
+//
+int historyEncode(byte *p, unsigned long value) {
+  int n = 0;
+  while(value >= 0x80) {
+    p[n++] = value | 0x80;
+    value >>= 7;
+  }
+  p[n++] = value;
+  return n;
+}
+
+//  Read a variable length unsigned integer from a tier ring, advancing pos
+//
+unsigned long historyDecode(int h, int t, word &pos) {
+  word size = historyOffset[t +1] - historyOffset[t];
+  unsigned long value = 0;
+  for(int shift = 0; ; shift += 7) {
+    byte b = histCache[h].data[historyOffset[t] + pos];
+    pos = (pos +1) % size;
+    value |= (unsigned long)(b & 0x7f) << shift;
+    if(!(b & 0x80)) return value;
+  }
 }
 
-//  Load the history instruction information from file
+//  Signed to unsigned so small -ve deltas stay small: 0, -1, 1, -2 ... => 0, 1, 2, 3 ...
 //
-void loadHistCache() {
-  
+unsigned long historyZigzag(long value) {
+  return ((unsigned long)value << 1) ^ (unsigned long)(value >> (sizeof(long) * 8 -1));
+}
+
+long historyUnzigzag(unsigned long value) {
+  return (long)(value >> 1) ^ -(long)(value & 1);
+}
+
+//  Save the history instruction information to file
+//  Read back by storeBegin at boot
+//
+void saveHistCache() {
+  for(int h = 0; h < HISTORY_CACHE_SIZE; h++) {
+    if(histCache[h].address != 0) storeKeep(h);
+  }
 }
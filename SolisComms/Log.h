@@ -0,0 +1,50 @@
+/*
+
+    Log.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define LOG_ERROR 1                           // levels
+#define LOG_WARN 2
+#define LOG_INFO 3
+#define LOG_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_INFO                    // levels above this compile to nothing
+#endif
+
+#define LOG_BUFFER 2048                       // recent log kept in RAM, served by /log, power of 2
+#define LOG_LINE 96                           // longest line, longer are cut short
+
+//  Log lines printf style, e.g. LOG_I("Store replayed %lu bytes", size)
+//  Formatted into the ring, written to serial later from the main loop
+//
+#if LOG_LEVEL >= LOG_ERROR
+#define LOG_E(...) logWrite('E', __VA_ARGS__)
+#else
+#define LOG_E(...)
+#endif
+
+#if LOG_LEVEL >= LOG_WARN
+#define LOG_W(...) logWrite('W', __VA_ARGS__)
+#else
+#define LOG_W(...)
+#endif
+
+#if LOG_LEVEL >= LOG_INFO
+#define LOG_I(...) logWrite('I', __VA_ARGS__)
+#else
+#define LOG_I(...)
+#endif
+
+#if LOG_LEVEL >= LOG_DEBUG
+#define LOG_D(...) logWrite('D', __VA_ARGS__)
+#else
+#define LOG_D(...)
+#endif
+
+void logWrite(char level, const char *format, ...);
+const char *logAddress(IPAddress ip);
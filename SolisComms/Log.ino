@@ -0,0 +1,77 @@
+/*
+
+    Log
+    https://github.com/RichardL64
+
+    Leveled logging without blocking the poll loop or request handling
+
+    Lines are formatted into a LOG_BUFFER byte RAM ring, "<millis> <level> <text>", and written to serial
+    from the end of the main loop, only as much as the serial port takes without waiting.
+    The ring keeps the most recent lines, oldest overwritten, readable at /log.
+    Levels above LOG_LEVEL compile to nothing, arguments included.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+char logRing[LOG_BUFFER];
+unsigned long logHead;                        // bytes ever logged, ring position = logHead % LOG_BUFFER
+unsigned long logSent;                        // bytes ever written to serial
+
+//  Format a line into the ring
+//
+void logWrite(char level, const char *format, ...) {
+  char line[LOG_LINE];
+  int l = snprintf(line, LOG_LINE, "%lu %c ", millis(), level);
+
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(line + l, LOG_LINE - l, format, args);
+  va_end(args);
+  l = n < 0 ? l : min(l + n, LOG_LINE -1);                    // cut short
+  line[l++] = '\n';
+
+  for(int c = 0; c < l; c++) logRing[logHead++ % LOG_BUFFER] = line[c];
+}
+
+//  An IP address as text for a log line, reused by the next call
+//  Called inside the LOG_ arguments so the address is only fetched if the level is compiled in
+//
+const char *logAddress(IPAddress ip) {
+  static char text[16];
+  snprintf(text, sizeof(text), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
+  return text;
+}
+
+//  Write what the serial port will take without waiting
+//  Called at the end of the main loop
+//
+void logDrain() {
+  if(logHead - logSent > LOG_BUFFER) logSent = logHead - LOG_BUFFER;   // overwritten before it was sent
+
+  int room = Serial.availableForWrite();
+  while(room > 0 && logSent != logHead) {
+    int pos = logSent % LOG_BUFFER;
+    int n = min((unsigned long)room, min(logHead - logSent, (unsigned long)(LOG_BUFFER - pos)));
+    Serial.write((const uint8_t *)logRing + pos, n);
+    logSent += n;
+    room -= n;
+  }
+}
+
+//  The ring as text, oldest whole line first
+//
+void logText(HttpWriter &out) {
+  unsigned long start = logHead > LOG_BUFFER ? logHead - LOG_BUFFER : 0;
+  if(start > 0) {                                             // skip the partly overwritten line
+    while(start != logHead && logRing[start % LOG_BUFFER] != '\n') start++;
+    if(start != logHead) start++;
+  }
+
+  while(start != logHead) {
+    int pos = start % LOG_BUFFER;
+    int n = min(logHead - start, (unsigned long)(LOG_BUFFER - pos));
+    out.write((const uint8_t *)logRing + pos, n);
+    start += n;
+  }
+}
@@ -0,0 +1,84 @@
+/*
+
+    Memo
+    https://github.com/RichardL64
+
+    Remember rendered /R response bodies so identical requests, e.g. several dashboards, aren't re-parsed and re-formatted
+
+    Keyed by a hash of the request URL. A body is sent again while it's from the current Snapshot
+    and no cache entry has been added or removed.
+    Replaying still counts as a request for each register, keeping them cached and applying any lease.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+responseMemo memos[MEMO_SIZE];
+responseMemo *memoRecording;                  // being rendered
+
+//  FNV-1a hash of the request URL, path and query with its separators as \0
+//
+unsigned long memoHash(httpRequest &req) {
+  unsigned long hash = 2166136261UL;
+  for(const char *p = req.path; p < req.end; p++) {
+    hash = (hash ^ (byte)*p) * 16777619UL;
+  }
+  return hash;
+}
+
+//  Send a remembered body for the request if there hasn't been a snapshot since
+//  Returns false if there isn't one
+//
+bool memoReply(unsigned long hash, unsigned long lease, HttpWriter &out) {
+  for(int m = 0; m < MEMO_SIZE; m++) {
+    responseMemo &memo = memos[m];
+    if(!memo.ready || memo.hash != hash) continue;
+    if(memo.cycle != snapshot.cycle || memo.layout != cacheLayout) return false;
+
+    for(int n = 0; n < memo.count; n++) {
+      cacheTouch(memo.index[n]);
+      registerLease(memo.index[n], lease);
+    }
+    out.write((const uint8_t *)memo.body, memo.length);
+    memo.used = millis();
+    metrics.memoHits++;
+    return true;
+  }
+  return false;
+}
+
+//  Start remembering a response, replacing the one with the same hash or the least recently used
+//
+responseMemo *memoStart(unsigned long hash) {
+  int m = 0;
+  for(int n = 1; n < MEMO_SIZE && memos[m].hash != hash; n++) {
+    if(memos[n].hash == hash || (long)(memos[n].used - memos[m].used) < 0) m = n;
+  }
+
+  memoRecording = &memos[m];
+  memoRecording->hash = hash;
+  memoRecording->ready = false;
+  memoRecording->length = 0;
+  memoRecording->count = 0;
+  return memoRecording;
+}
+
+//  Note a cache entry in the response being remembered
+//  Too many, or refused with the cache full, and it isn't kept
+//
+void memoIndex(int i) {
+  if(memoRecording == 0) return;
+  if(i == -1 || memoRecording->count == MEMO_INDEXES) memoRecording->length = -1;
+  else memoRecording->index[memoRecording->count++] = i;
+}
+
+//  Finish remembering, once the body has been flushed
+//
+void memoEnd() {
+  if(memoRecording == 0) return;
+  memoRecording->ready = memoRecording->length >= 0;
+  memoRecording->cycle = snapshot.cycle;
+  memoRecording->layout = cacheLayout;
+  memoRecording->used = millis();
+  memoRecording = 0;
+}
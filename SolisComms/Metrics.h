@@ -0,0 +1,36 @@
+/*
+
+    Metrics.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define METRIC_BUCKETS 5                      // histogram bounds, decades 100us to 1s, plus +Inf
+#define METRIC_ROUTES 15                      // HTTP routes timed, httpRoutes then one for anything else
+
+//  Fixed bucket histogram of times in us
+//
+struct metricHistogram {
+    unsigned long bucket[METRIC_BUCKETS +1];  // counts, not cumulative
+    uint64_t sum;                             // total us
+};
+
+//  Counters kept while running, reported by /metrics
+//
+struct {
+    metricHistogram loop;                     // loop() pass
+    metricHistogram wifi;                     // serviceWiFi() pass
+    metricHistogram modbus;                   // modbus request round trip
+    metricHistogram route[METRIC_ROUTES];     // HTTP response by route
+    unsigned long modbusErrors;               // modbus requests failed
+    unsigned long cacheHits;                  // register lookups found in the cache
+    unsigned long cacheMisses;                // lookups adding a register
+    unsigned long cacheEvictions;             // registers dropped for space
+    unsigned long cacheExpired;               // registers dropped as no longer requested
+    unsigned long cacheRejected;              // registers refused, the cache full of registers in use
+    unsigned long memoHits;                   // /R responses replayed from the memo
+    unsigned long wifiReconnects;
+    unsigned long mdnsRestarts;               // mDNS restarted after a stalled mdns.run()
+} metrics;
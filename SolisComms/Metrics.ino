@@ -0,0 +1,185 @@
+/*
+
+    Metrics
+    https://github.com/RichardL64
+
+    Counters and fixed bucket histograms of the hot paths, always on
+    Served at /metrics in Prometheus text format for an external scraper
+
+      solis_loop_seconds                  loop() pass
+      solis_wifi_service_seconds          serviceWiFi() pass, time clients and modbus wait
+      solis_modbus_request_seconds        modbus round trip, with errors in total and by address
+      solis_http_request_seconds          HTTP response time by route, /R responses replayed from the memo
+      solis_cache_*                       register cache hits, misses, evictions, expiry and refusals
+      solis_free_ram_bytes, solis_wifi_reconnects_total, solis_mdns_restarts_total
+
+    Histogram buckets are decades so recording is a few compares, counts are 32 bit and wrap
+
+    R.A.Lincoln       July 2022
+
+*/
+
+const unsigned long metricBound[METRIC_BUCKETS] = {100, 1000, 10000, 100000, 1000000};   // us
+const char *const metricBoundLabel[METRIC_BUCKETS] = {"0.0001", "0.001", "0.01", "0.1", "1"};
+
+//  Time the main loop pass, from the previous call
+//
+void metricsLoop() {
+  static unsigned long last;
+  unsigned long now = micros();
+  if(last != 0) metricsTime(metrics.loop, now - last);
+  last = now;
+}
+
+//  Add a time in us to a histogram
+//
+void metricsTime(metricHistogram &h, unsigned long us) {
+  int b = 0;
+  while(b < METRIC_BUCKETS && us > metricBound[b]) b++;
+  h.bucket[b]++;
+  h.sum += us;
+}
+
+//  Free RAM between the heap and the stack
+//
+extern "C" char *sbrk(int i);
+
+int metricsFreeRam() {
+  char top;
+  return &top - sbrk(0);
+}
+
+//  Write everything in Prometheus text format
+//
+void metricsWrite(HttpWriter &out) {
+  metricsHistogram(out, "solis_loop_seconds", "Main loop pass time", metrics.loop, 0);
+  metricsHistogram(out, "solis_wifi_service_seconds", "Time servicing WiFi clients per loop", metrics.wifi, 0);
+  metricsHistogram(out, "solis_modbus_request_seconds", "Modbus request round trip time", metrics.modbus, 0);
+
+  metricsHelp(out, "solis_http_request_seconds", "HTTP response time by route", "histogram");
+  for(int r = 0; r < METRIC_ROUTES; r++) {
+    metricsHistogram(out, "solis_http_request_seconds", 0, metrics.route[r], r < METRIC_ROUTES -1 ? httpRoutes[r].path : "other");
+  }
+
+  metricsCounter(out, "solis_modbus_errors_total", "Modbus requests failed", metrics.modbusErrors);
+
+  metricsHelp(out, "solis_modbus_register_reads_total", "Register reads by address", "counter");
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address == 0) continue;
+    metricsAddress(out, "solis_modbus_register_reads_total", regCache[i].address, regCache[i].reads);
+  }
+  metricsHelp(out, "solis_modbus_register_errors_total", "Register read errors by address", "counter");
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address == 0) continue;
+    metricsAddress(out, "solis_modbus_register_errors_total", regCache[i].address, regCache[i].errors);
+  }
+
+  int entries = 0;
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address != 0) entries++;
+  }
+  metricsCounter(out, "solis_cache_hits_total", "Register lookups found in the cache", metrics.cacheHits);
+  metricsCounter(out, "solis_cache_misses_total", "Register lookups added to the cache", metrics.cacheMisses);
+  metricsCounter(out, "solis_cache_evictions_total", "Registers dropped for space", metrics.cacheEvictions);
+  metricsCounter(out, "solis_cache_expired_total", "Registers dropped as no longer requested", metrics.cacheExpired);
+  metricsCounter(out, "solis_cache_rejected_total", "Registers refused with the cache full", metrics.cacheRejected);
+  metricsGauge(out, "solis_cache_entries", "Registers in the cache", entries);
+
+  metricsGauge(out, "solis_free_ram_bytes", "Free RAM between heap and stack", metricsFreeRam());
+  metricsCounter(out, "solis_http_memo_hits_total", "/R responses replayed from the memo", metrics.memoHits);
+  metricsCounter(out, "solis_wifi_reconnects_total", "WiFi reconnections", metrics.wifiReconnects);
+  metricsCounter(out, "solis_mdns_restarts_total", "mDNS restarted after stalling", metrics.mdnsRestarts);
+  metricsCounter(out, "solis_uptime_seconds", "Seconds since boot, wraps at 49 days", millis() / 1000);
+}
+
+//  # HELP and # TYPE lines
+//
+void metricsHelp(HttpWriter &out, const char *name, const char *help, const char *type) {
+  out.print(F("# HELP "));
+  out.print(name);
+  out.write(' ');
+  out.print(help);
+  out.print(F("\n# TYPE "));
+  out.print(name);
+  out.write(' ');
+  out.print(type);
+  out.write('\n');
+}
+
+void metricsCounter(HttpWriter &out, const char *name, const char *help, unsigned long value) {
+  metricsHelp(out, name, help, "counter");
+  out.print(name);
+  out.write(' ');
+  out.print(value);
+  out.write('\n');
+}
+
+void metricsGauge(HttpWriter &out, const char *name, const char *help, long value) {
+  metricsHelp(out, name, help, "gauge");
+  out.print(name);
+  out.write(' ');
+  out.writeLong(value);
+  out.write('\n');
+}
+
+//  name{address="33057"} value
+//
+void metricsAddress(HttpWriter &out, const char *name, int address, unsigned long value) {
+  out.print(name);
+  out.print(F("{address=\""));
+  printRegister(out, address);
+  out.print(F("\"} "));
+  out.print(value);
+  out.write('\n');
+}
+
+//  Cumulative buckets, sum in seconds and count
+//  With a help line unless help is 0, and a route label if passed
+//
+void metricsHistogram(HttpWriter &out, const char *name, const char *help, metricHistogram &h, const char *route) {
+  if(help != 0) metricsHelp(out, name, help, "histogram");
+
+  unsigned long count = 0;
+  for(int b = 0; b <= METRIC_BUCKETS; b++) {
+    count += h.bucket[b];
+    out.print(name);
+    out.print(F("_bucket{"));
+    if(route != 0) {
+      out.print(F("route=\""));
+      out.print(route);
+      out.print(F("\","));
+    }
+    out.print(F("le=\""));
+    out.print(b < METRIC_BUCKETS ? metricBoundLabel[b] : "+Inf");
+    out.print(F("\"} "));
+    out.print(count);
+    out.write('\n');
+  }
+
+  metricsLabelled(out, name, "_sum", route);
+  out.print((unsigned long)(h.sum / 1000000));
+  out.write('.');
+  unsigned long us = h.sum % 1000000;
+  for(unsigned long d = 100000; d > 1; d /= 10) {
+    if(us < d) out.write('0');                    // leading zeros of the fraction
+  }
+  out.print(us);
+  out.write('\n');
+
+  metricsLabelled(out, name, "_count", route);
+  out.print(count);
+  out.write('\n');
+}
+
+//  name_suffix{route="/R"}
+//
+void metricsLabelled(HttpWriter &out, const char *name, const char *suffix, const char *route) {
+  out.print(name);
+  out.print(suffix);
+  if(route != 0) {
+    out.print(F("{route=\""));
+    out.print(route);
+    out.print(F("\"}"));
+  }
+  out.write(' ');
+}
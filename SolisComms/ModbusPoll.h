@@ -0,0 +1,44 @@
+/*
+
+    ModbusPoll.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define MODBUS_DEVICE 1                       // inverter modbus slave id, plain addresses
+#define MODBUS_TIMEOUT 1000                   // ms to wait for a response, unless the device has its own
+#define MODBUS_MAX_READ 125                   // modbus limit on registers per read request
+#define MODBUS_GAP 40                         // max unrequested registers read through to join two spans
+
+#define POLL_DEFAULT 2000                     // ms refresh interval of a new register
+#define POLL_MIN 1000                         // learned refresh interval limits
+#define POLL_MAX 60000
+#define POLL_BACKOFF 300000                   // longest ms between retries of a failing register
+
+#define BUS_TRIP 5                            // consecutive failed requests that open the bus circuit breaker
+#define BUS_PROBE 5000                        // ms between probes of an open bus, doubling
+#define BUS_PROBE_MAX 60000
+#define BUS_DEVICES 4                         // modbus devices sharing the RS485 bus
+
+//  A device on the bus, with its own timing and circuit breaker
+//
+struct busDevice {
+    byte id;                                  // modbus slave id, 0 unused
+    unsigned long turnaround;                 // ms of quiet on the bus before a request to it
+    unsigned long timeout;                    // ms to wait for its response
+    unsigned long used;                       // ms of bus time it has had, the least used goes next
+    byte failures;                            // consecutive failed requests
+    unsigned long probe;                      // ms between probes while its breaker is open, 0 closed
+    unsigned long probed;                     // millis last probe
+};
+
+//  A single block read covering one or more cached registers, in planOrder
+//
+struct readSpan {
+    int start;                                // first register address
+    int count;                                // number of registers to read
+    cacheIndex first;                         // first planOrder position covered
+    cacheIndex entries;                       // number of planOrder positions covered
+};
@@ -0,0 +1,353 @@
+/*
+
+    ModbusPoll
+    https://github.com/RichardL64
+
+    Read the cached register list from the inverter, and any other modbus devices on the same RS485 bus
+
+    Each register has its own refresh interval and next due time, the most overdue register is always read next.
+    Intervals are requested by clients, <address>@<seconds>s, or learned - halved when the value changes on a read
+    and stretched a quarter when it doesn't, between POLL_MIN and POLL_MAX.
+
+    The read is widened into a span over neighbouring registers that are at least half way to due,
+    joining addresses less than MODBUS_GAP apart and reading through the unrequested registers in between,
+    as a few extra bytes on the wire cost much less than another round trip at 9600 bps.
+
+    A failed block read could be any one of its registers, they are flagged to be read on their own.
+    Failing on its own a register is retried after exponentially longer waits, up to POLL_BACKOFF,
+    so a few bad addresses don't hold up the healthy ones with a modbus timeout every pass.
+
+    BUS_TRIP failed requests in a row, e.g. the inverter asleep overnight, opens a circuit breaker.
+    Polling stops, a single known good register is probed at increasing intervals, and the first good
+    read closes the breaker with every register due straight away. Failures while open aren't held against registers.
+
+    Reads don't hold up the loop, pollSpan starts one and pollResult takes the values when it's done, see ModbusRtu.
+
+    Registers on other devices, <device>:<address>, are read in spans of their own device only.
+    Each device has its own breaker, response timeout and turnaround - quiet time on the bus before a request to it.
+    The bus is shared fairly: of the devices with a read due, the one that has had the least bus time goes next,
+    so a slow or failing device can't take the poll cycle from the others.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Devices with their own timing, others get MODBUS_TIMEOUT and no turnaround
+//
+const struct {
+  byte id;
+  unsigned long turnaround;
+  unsigned long timeout;
+} busTiming[] = {
+  {MODBUS_DEVICE, 0, MODBUS_TIMEOUT},               // Solis inverter
+  {2, 0, MODBUS_TIMEOUT},                           // second inverter
+  {3, 50, 500},                                     // Pylontech BMS, slow to turn around, quick to answer
+};
+
+cacheIndex planOrder[CACHE_SIZE];             // cache indexes sorted by address, so grouped by device
+
+busDevice busDevices[BUS_DEVICES];
+unsigned long busEnd;                         // millis the last request finished
+
+busDevice *pollDevice;                        // read in progress, see ModbusRtu
+readSpan pollReading;
+unsigned long pollStarted;                    // micros
+
+//  Read the most overdue register, and any neighbours nearly due, in one request
+//  To the device with a read due that has had the least bus time
+//
+void pollNext() {
+  if(rtuBusy()) return;                             // a read in progress
+
+  unsigned long now = millis();
+  int n = pollSort();
+
+  int best = -1, next = -1;
+  for(int d = 0; d < BUS_DEVICES; d++) {
+    busDevice &dev = busDevices[d];
+    if(dev.id == 0 || now - busEnd < dev.turnaround) continue;
+
+    int p = dev.probe != 0 ? pollProbe(dev, n, now) : pollDue(dev, n, now);
+    if(p == -1) continue;                           // nothing due
+    if(best == -1 || (long)(dev.used - busDevices[best].used) < 0) {
+      best = d;
+      next = p;
+    }
+  }
+  if(best == -1) return;                            // nothing due
+
+  busDevice &dev = busDevices[best];
+  readSpan span;
+  if(dev.probe != 0) {                              // breaker open - the one register on its own
+    int i = planOrder[next];
+    dev.probed = now;
+    span = {regCache[i].address, regCache[i].size, (cacheIndex)next, 1};
+  } else {
+    span = pollPlan(next, n, now);
+  }
+
+  snapshotBegin();
+  pollSpan(dev, span);
+}
+
+//  The device's most overdue register, planOrder position or -1 if none are due
+//
+int pollDue(busDevice &dev, int n, unsigned long now) {
+  int next = -1;
+  long overdue = -1;
+  for(int p = 0; p < n; p++) {
+    if(registerDevice(regCache[planOrder[p]].address) != dev.id) continue;
+    long late = now - regCache[planOrder[p]].due;   // -ve = not yet due
+    if(late > overdue) {
+      overdue = late;
+      next = p;
+    }
+  }
+  return next;
+}
+
+//  Sort the live, real, cache entries by address into planOrder
+//  Adds any new devices to the bus, and drops those with nothing to read
+//  Returns the number of entries
+//
+int pollSort() {
+  for(int d = 0; d < BUS_DEVICES; d++) {            // drop devices with no registers left
+    int i = 0;
+    while(i < CACHE_SIZE
+       && (regCache[i].address == 0 || registerDevice(regCache[i].address) != busDevices[d].id)) i++;
+    if(i == CACHE_SIZE) busDevices[d].id = 0;
+  }
+
+  int n = 0;
+  for(int i = 0; i < CACHE_SIZE; i++) {             // insertion sort live entries by address
+    if(regCache[i].address == 0
+    || (regCache[i].flags & REG_VIRTUAL)) continue;   // nothing to read
+    if(busFind(registerDevice(regCache[i].address)) == 0) continue;   // bus full
+
+    int p = n++;
+    for(; p > 0 && regCache[planOrder[p -1]].address > regCache[i].address; p--) {
+      planOrder[p] = planOrder[p -1];
+    }
+    planOrder[p] = i;
+  }
+  return n;
+}
+
+//  Build a span from planOrder position p outwards, no longer than MODBUS_MAX_READ
+//  Neighbours are only worth joining if they are at least half way to due
+//
+readSpan pollPlan(int p, int n, unsigned long now) {
+  int start = regCache[planOrder[p]].address;
+  int end = start + regCache[planOrder[p]].size;    // one past the last register
+  int first = p, last = p;
+  if(regCache[planOrder[p]].flags & REG_SOLO) return {start, end - start, (cacheIndex)p, 1};
+
+  for(int q = p +1; q < n; q++) {                   // extend upwards
+    int i = planOrder[q];
+    int qEnd = regCache[i].address + regCache[i].size;
+    if(regCache[i].address - end > MODBUS_GAP) break;
+    if(qEnd - start > MODBUS_MAX_READ) break;
+    if(!pollSoon(i, now) || (regCache[i].flags & REG_SOLO)) continue;
+    end = max(end, qEnd);
+    last = q;
+  }
+
+  for(int q = p -1; q >= 0; q--) {                  // extend downwards
+    int i = planOrder[q];
+    if(start - (regCache[i].address + regCache[i].size) > MODBUS_GAP) break;
+    if(end - regCache[i].address > MODBUS_MAX_READ) break;
+    if(!pollSoon(i, now) || (regCache[i].flags & REG_SOLO)) continue;
+    start = min(start, regCache[i].address);
+    first = q;
+  }
+
+  return {start, end - start, (cacheIndex)first, (cacheIndex)(last - first +1)};
+}
+
+//  True if the register is at least half way through its interval
+//
+bool pollSoon(int i, unsigned long now) {
+  return (long)(regCache[i].due - now) <= (long)(regCache[i].interval / 2);
+}
+
+//  Breaker open - read one register on its own every probe ms
+//  The most overdue that hasn't been failing, so a bad address doesn't keep the breaker open
+//  Returns the planOrder position to probe, -1 if not time yet
+//
+int pollProbe(busDevice &dev, int n, unsigned long now) {
+  if(now - dev.probed < dev.probe) return -1;
+
+  int next = -1;
+  for(int p = 0; p < n; p++) {
+    int i = planOrder[p];
+    if(registerDevice(regCache[i].address) != dev.id) continue;
+    if(next == -1) {
+      next = p;
+      continue;
+    }
+    int best = planOrder[next];
+    if(regCache[i].failures < regCache[best].failures
+    || (regCache[i].failures == regCache[best].failures && (long)(regCache[i].due - regCache[best].due) < 0)) next = p;
+  }
+  return next;
+}
+
+//  Return the device's bus entry, adding it with its timing if new, 0 if the bus is full
+//  A new device starts level with the least used so it neither waits nor hogs the bus
+//
+busDevice *busFind(int id) {
+  busDevice *free = 0;
+  unsigned long used = 0;
+  bool any = false;
+  for(int d = 0; d < BUS_DEVICES; d++) {
+    busDevice &dev = busDevices[d];
+    if(dev.id == id) return &dev;
+    if(dev.id == 0) {
+      if(free == 0) free = &dev;
+    } else if(!any || (long)(dev.used - used) < 0) {
+      used = dev.used;
+      any = true;
+    }
+  }
+  if(free == 0) return 0;
+
+  memset(free, 0, sizeof(busDevice));
+  free->id = id;
+  free->used = used;
+  free->timeout = MODBUS_TIMEOUT;
+  for(unsigned int t = 0; t < sizeof(busTiming) / sizeof(busTiming[0]); t++) {
+    if(busTiming[t].id != id) continue;
+    free->turnaround = busTiming[t].turnaround;
+    free->timeout = busTiming[t].timeout;
+  }
+  return free;
+}
+
+//  Track consecutive failed requests to a device, opening and closing its breaker
+//
+void pollBus(busDevice &dev, bool good) {
+  if(good) {
+    dev.failures = 0;
+    if(dev.probe == 0) return;
+
+    dev.probe = 0;                                  // close - everything due now, failures forgiven
+    for(int i = 0; i < CACHE_SIZE; i++) {
+      if(regCache[i].address == 0 || registerDevice(regCache[i].address) != dev.id) continue;
+      regCache[i].failures = 0;
+      regCache[i].flags &= ~REG_SOLO;
+      regCache[i].due = millis();
+    }
+    LOG_I("Modbus breaker closed %d", dev.id);
+    return;
+  }
+
+  if(dev.probe != 0) {                              // probe failed - wait longer
+    dev.probe = min(dev.probe * 2, (unsigned long)BUS_PROBE_MAX);
+    return;
+  }
+  if(++dev.failures >= BUS_TRIP) {                  // open
+    dev.probe = BUS_PROBE;
+    dev.probed = millis();
+    LOG_W("Modbus breaker open %d", dev.id);
+  }
+}
+
+//  A failed read
+//  Part of a block read it is read on its own next, to find out if it was to blame, a good read rejoins it to spans
+//  On its own it waits exponentially longer each time, from its interval to POLL_BACKOFF
+//
+void pollBackoff(int i, bool joined) {
+  if(joined) {
+    regCache[i].flags |= REG_SOLO;
+    regCache[i].due = millis();
+    return;
+  }
+
+  if(regCache[i].failures < 255) regCache[i].failures++;
+  unsigned long backoff = regCache[i].interval << min((int)regCache[i].failures, 8);
+  regCache[i].due = millis() + min(backoff, (unsigned long)POLL_BACKOFF);
+}
+
+//  Learn the refresh interval from whether the value changed on a read
+//  Requested intervals are left alone
+//
+void pollLearn(int i, bool changed) {
+  if(regCache[i].flags & REG_INTERVAL) return;
+
+  unsigned long interval = regCache[i].interval;
+  if(changed) interval /= 2;
+  else interval += interval / 4;
+  regCache[i].interval = constrain(interval, (unsigned long)POLL_MIN, (unsigned long)POLL_MAX);
+}
+
+//  Start reading one span from its device, pollResult gets the values
+//
+void pollSpan(busDevice &dev, readSpan &span) {
+  pollDevice = &dev;
+  pollReading = span;
+  pollStarted = micros();
+  rtuRead(dev.id, registerAddress(span.start), span.count, dev.timeout, pollResult);
+}
+
+//  Scatter a span's values into the cache
+//  Every register inside the span is updated, due or not
+//
+void pollResult(bool good, const word *data, int count) {
+  busDevice &dev = *pollDevice;
+  readSpan &span = pollReading;
+
+  unsigned long elapsed = micros() - pollStarted;
+  metricsTime(metrics.modbus, elapsed);
+  if(!good) metrics.modbusErrors++;
+  dev.used += elapsed / 1000;
+  busEnd = millis();
+
+  bool blame = dev.probe == 0;                                  // failures with the breaker open are the device's
+  pollBus(dev, good);
+  if(good) LOG_D("%d:%d+%d read", dev.id, registerAddress(span.start), span.count);
+  else LOG_W("%d:%d+%d data error", dev.id, registerAddress(span.start), span.count);
+
+  for(int p = span.first; p < span.first + span.entries; p++) {
+    int i = planOrder[p];
+    int address = regCache[i].address;
+    int size = regCache[i].size;
+    if(address < span.start 
+    || address + size > span.start + span.count) continue;    // outside the span
+
+    BENCH(if(regCache[i].sampled != 0) benchRefresh(millis() - regCache[i].sampled));
+    unsigned long version = regCache[i].version;
+    regCache[i].reads++;
+
+    if(!good) {
+      setCache(i, 0, STATE_ERROR);
+      regCache[i].errors++;
+
+    } else {                                                    // else good data
+      regCache[i].failures = 0;
+      regCache[i].flags &= ~REG_SOLO;                           // not to blame, joins spans again
+      int offset = address - span.start;
+      long value = 0;
+      if(size == 2) value = (long)data[offset++] <<16;         // 32 bit High 16
+      value |= data[offset];                                    // Low 16 bits
+      setCache(i, value);                                       // update the real time cache
+      setHistory(address, value);                               // upate history
+    }
+
+    if(address == 101) setCache(i, random(0, 1000));            // Random number test data on 101
+    if(address == 102) setCache(i, millis());                   // Incrementing millis test data on 102
+
+    if(good) {
+      pollLearn(i, regCache[i].version != version);
+      regCache[i].due = millis() + regCache[i].interval;
+    } else if(blame) {
+      pollBackoff(i, span.entries > 1);
+    } else {
+      regCache[i].due = millis() + regCache[i].interval;
+    }
+
+    LOG_D(" %d:%d = %ld", dev.id, registerAddress(address), regCache[i].value);
+  }
+
+  virtualUpdate();                                  // recalculate from any changed values
+  snapshotUpdate();                                 // publish for /R and event streams at the end of a cycle
+}
@@ -0,0 +1,42 @@
+/*
+
+    ModbusRtu.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define MODBUS_BAUD 9600                      // RS485 bus speed, 8N1
+#define RTU_CHAR_US (10 * 1000000UL / MODBUS_BAUD)   // us per char on the wire, 10 bits
+#if MODBUS_BAUD > 19200
+#define RTU_T35 1750                          // us of silence ending a frame, fixed above 19200 bps
+#else
+#define RTU_T35 (RTU_CHAR_US * 7 / 2)         // 3.5 chars
+#endif
+#define RTU_FRAME 256                         // longest frame, read of MODBUS_MAX_READ registers is 255
+#define RTU_READ_INPUT 0x04                   // function code, read input registers
+
+#define RTU_IDLE 0                            // no transaction, bus quiet once RTU_T35 after the last
+#define RTU_SENDING 1                         // request frame going out of the UART
+#define RTU_WAITING 2                         // waiting for the first byte of the response
+#define RTU_RECEIVING 3                       // response arriving
+
+//  Result of a read, data holds count registers if good
+//
+typedef void (*rtuCallback)(bool good, const word *data, int count);
+
+//  The transaction in progress
+//
+struct {
+    byte state;                               // RTU_
+    byte id;                                  // device asked
+    int count;                                // registers asked for
+    unsigned long timeout;                    // ms allowed for the response to start
+    unsigned long start;                      // micros the state was entered
+    unsigned long last;                       // micros the last byte was sent or seen
+    int length;                               // response bytes so far
+    word crc;                                 // running CRC of the response, 0 when complete with its CRC
+    rtuCallback done;
+    byte frame[RTU_FRAME];
+} rtu;
@@ -0,0 +1,169 @@
+/*
+
+    ModbusRtu
+    https://github.com/RichardL64
+
+    Modbus RTU master that never waits on the bus
+
+    A blocking read held up the loop for the request, the device turnaround and the response at 9600 bps,
+    or the whole timeout on an error, and HTTP clients queued behind it. Here a read is started, then
+    moved on a step each pass of the loop through an explicit state per transaction:
+
+      RTU_SENDING     request frame written to the UART's transmit buffer, driver enabled until it's on the wire
+      RTU_WAITING     driver off, waiting up to the device timeout for the response to start
+      RTU_RECEIVING   bytes taken from the UART receive buffer as they come, the CRC updated as each arrives
+      RTU_IDLE        the result handed to the callback, the next request waits for RTU_T35 of silence
+
+    A response ends at its expected length, or after RTU_T35 of silence if it's cut short.
+    The serial receive buffer holds the bytes between passes, so the loop has to come round faster than it fills.
+
+    Built with SIMULATE_INVERTER the frames go to and from the byte level simulated devices in Simulator.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Bring the bus up
+//  Called from setup
+//
+void rtuBegin() {
+#ifndef SIMULATE_INVERTER
+  RS485.begin(MODBUS_BAUD);
+  RS485.setDelays(0, 0);                                    // frame timing kept here, not by waiting
+  RS485.receive();
+#endif
+}
+
+//  True while a transaction is in progress or the bus hasn't been quiet for RTU_T35 since
+//
+bool rtuBusy() {
+  return rtu.state != RTU_IDLE || micros() - rtu.last < RTU_T35;
+}
+
+//  Start reading count input registers from device id, the result is passed to done later
+//  Returns false if the bus is busy
+//
+bool rtuRead(byte id, int address, int count, unsigned long timeout, rtuCallback done) {
+  if(rtuBusy()) return false;
+
+  byte request[8] = {id, RTU_READ_INPUT, (byte)(address >> 8), (byte)address, (byte)(count >> 8), (byte)count};
+  word crc = 0xFFFF;
+  for(int b = 0; b < 6; b++) crc = crc16(crc, request[b]);
+  request[6] = crc;                                         // CRC low byte first
+  request[7] = crc >> 8;
+
+  rtu.id = id;
+  rtu.count = count;
+  rtu.timeout = timeout;
+  rtu.done = done;
+  rtu.length = 0;
+  rtu.crc = 0xFFFF;
+  rtuPortSend(request, sizeof(request));
+  rtuState(RTU_SENDING);
+  return true;
+}
+
+//  Move the transaction on a step, never waits
+//  Called from the main loop, and between clients so the receive buffer doesn't overflow
+//
+void rtuService() {
+  switch(rtu.state) {
+    case RTU_SENDING:                                       // the frame and the char in the shift register
+      if(micros() - rtu.start < 9 * RTU_CHAR_US) return;
+      rtuPortReceive();
+      rtuState(RTU_WAITING);
+      return;
+
+    case RTU_WAITING:
+    case RTU_RECEIVING: {
+      unsigned long now = micros();                         // before reading, a pause after can't pass for silence
+      for(int c = rtuPortRead(); c != -1; c = rtuPortRead()) {
+        if(rtu.length < RTU_FRAME) rtu.frame[rtu.length++] = c;
+        rtu.crc = crc16(rtu.crc, c);
+        rtu.last = micros();
+        rtu.state = RTU_RECEIVING;
+        if(rtuComplete()) {
+          rtuFinish(rtuCheck());
+          return;
+        }
+      }
+
+      if(rtu.state == RTU_RECEIVING) {
+        if((long)(now - rtu.last) >= (long)RTU_T35) rtuFinish(false);   // ended short, nothing since
+      } else if(now - rtu.start > rtu.timeout * 1000) {
+        rtuFinish(false);                                   // no response
+      }
+      return;
+    }
+  }
+}
+
+void rtuState(byte state) {
+  rtu.state = state;
+  rtu.start = micros();
+  rtu.last = rtu.start;
+}
+
+//  True once the response is as long as its header says
+//  id, function, byte count, data..., CRC or id, function | 0x80, exception code, CRC
+//
+bool rtuComplete() {
+  if(rtu.length < 3) return false;
+  int expected = (rtu.frame[1] & 0x80) ? 5 : 5 + rtu.frame[2];
+  return rtu.length >= expected;
+}
+
+//  True if the response is the answer to the request
+//  The CRC over a frame including its own CRC is 0
+//
+bool rtuCheck() {
+  return rtu.crc == 0
+    && rtu.frame[0] == rtu.id
+    && rtu.frame[1] == RTU_READ_INPUT
+    && rtu.frame[2] == 2 * rtu.count
+    && rtu.length == 5 + 2 * rtu.count;
+}
+
+//  End the transaction and pass on the result
+//
+void rtuFinish(bool good) {
+  static word data[RTU_FRAME / 2];
+  if(good) {
+    for(int r = 0; r < rtu.count; r++) data[r] = rtu.frame[3 + 2 * r] << 8 | rtu.frame[4 + 2 * r];
+  }
+  rtu.state = RTU_IDLE;
+  rtu.last = micros();
+  rtu.done(good, data, rtu.count);
+}
+
+//  The bus port, RS485 or the simulated devices
+//
+void rtuPortSend(const byte *frame, int length) {
+#ifdef SIMULATE_INVERTER
+  simReceive(frame, length);
+#else
+  while(RS485.available()) RS485.read();                    // anything left over from before
+  RS485.noReceive();
+  RS485.beginTransmission();
+  RS485.write(frame, length);                               // buffered by the UART, doesn't wait
+#endif
+}
+
+//  Back to receiving, once the request is out
+//
+void rtuPortReceive() {
+#ifndef SIMULATE_INVERTER
+  RS485.endTransmission();                                  // already sent, doesn't wait
+  RS485.receive();
+#endif
+}
+
+//  Next received byte, -1 if none
+//
+int rtuPortRead() {
+#ifdef SIMULATE_INVERTER
+  return simRead();
+#else
+  return RS485.read();
+#endif
+}
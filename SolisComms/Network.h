@@ -0,0 +1,18 @@
+/*
+
+    Network.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define NET_JOIN_TIMEOUT 20000                // ms allowed to join the network before trying again
+#define NET_RETRY 1000                        // ms before the first retry, doubled each failure
+#define NET_RETRY_MAX 60000                   // longest wait between retries
+#define MDNS_STALL 500                        // ms mdns.run() may take before mDNS is restarted
+#define WATCHDOG_PERIOD WDT_CONFIG_PER_16K_Val  // 16s at 1024Hz, loop stalled this long resets the board
+
+#define NET_DOWN 0                            // not connected, waiting to retry
+#define NET_JOINING 1                         // joining the network
+#define NET_UP 2                              // connected
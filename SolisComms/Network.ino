@@ -0,0 +1,137 @@
+/*
+
+    Network
+    https://github.com/RichardL64
+
+    WiFi and mDNS kept up alongside the poll loop
+
+    WiFi.begin() waits up to a minute for the network and the old setup looped on it, so a mesh handoff or
+    AP reboot stopped polling, history and rules until WiFi came back. Here joining is started directly
+    on the WiFi module and checked each loop pass, failures wait NET_RETRY doubling to NET_RETRY_MAX,
+    and everything else carries on collecting meanwhile.
+
+    mDNS is only registered again when the IP address changes.
+    mDNS has been seen to lock up, see the README. A slow mdns.run() restarts it, and a hardware watchdog
+    resets the board if the loop stops altogether - registers and history come back from the Store.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+byte netState;                                // NET_
+unsigned long netStarted;                     // millis entered the state
+unsigned long netRetry;                       // ms to wait in NET_DOWN
+IPAddress netAddress;                         // registered with mDNS, 0 none
+
+//  Start joining the network
+//  Called from setup
+//
+void netBegin() {
+  netRetry = 0;
+  netDown();
+  watchdogBegin();
+}
+
+//  Move the connection on a step, never waits for the network
+//  Called from the main loop
+//
+void netService() {
+  watchdogKick();
+
+  switch(netState) {
+    case NET_DOWN:
+      if(millis() - netStarted < netRetry) return;
+
+      LOG_I("WiFi begin");
+      WiFi.setHostname(HOSTNAME);
+      WiFiDrv::wifiSetPassphrase(SECRET_SSID, strlen(SECRET_SSID), SECRET_PASS, strlen(SECRET_PASS));   // defined in Arduino_secrets.h
+      netState = NET_JOINING;
+      netStarted = millis();
+      return;
+
+    case NET_JOINING: {
+      byte status = WiFi.status();
+      if(status == WL_CONNECTED) {
+        netUp();
+      } else if(status == WL_CONNECT_FAILED
+             || millis() - netStarted > NET_JOIN_TIMEOUT) {
+        netRetry = netRetry == 0 ? NET_RETRY : min(netRetry * 2, (unsigned long)NET_RETRY_MAX);
+        LOG_W("WiFi join failed, retry in %lus", netRetry / 1000);
+        netDown();
+      }
+      return;
+    }
+
+    case NET_UP: {
+      if(WiFi.status() != WL_CONNECTED) {
+        metrics.wifiReconnects++;
+        LOG_W("WiFi lost");
+        netRetry = 0;                                       // straight back
+        netDown();
+        return;
+      }
+
+      unsigned long start = millis();
+      mdns.run();
+      if(millis() - start > MDNS_STALL) {
+        metrics.mdnsRestarts++;
+        LOG_W("mDNS stalled %lums, restarting", millis() - start);
+        mdnsBegin();
+      }
+      return;
+    }
+  }
+}
+
+void netDown() {
+  netState = NET_DOWN;
+  netStarted = millis();
+  digitalWrite(LED_BUILTIN, HIGH);                          // LED lit while not connected
+}
+
+//  Joined, register with mDNS if the address is new
+//
+void netUp() {
+  netState = NET_UP;
+  netStarted = millis();
+  netRetry = 0;
+  digitalWrite(LED_BUILTIN, LOW);
+
+  printWifiStatus();
+  if(WiFi.localIP() != netAddress) mdnsBegin();
+}
+
+//  Advertise as HOSTNAME on the current address
+//
+void mdnsBegin() {
+  LOG_I("mDNS begin");
+  if(netAddress != IPAddress(0, 0, 0, 0)) {                 // drop the old registration
+    mdns.removeAllServiceRecords();
+    udp.stop();
+  }
+  netAddress = WiFi.localIP();
+  mdns.begin(netAddress, HOSTNAME);
+  mdns.addServiceRecord(SERVICENAME, 80, MDNSServiceTCP);
+}
+
+//  SAMD21 watchdog on the 32kHz ultra low power oscillator, divided to 1024Hz
+//  Resets the board unless kicked within WATCHDOG_PERIOD
+//
+void watchdogBegin() {
+  GCLK->GENDIV.reg = GCLK_GENDIV_ID(2) | GCLK_GENDIV_DIV(4);               // 32768 / 2^(4+1)
+  GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(2) | GCLK_GENCTRL_GENEN | GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_DIVSEL;
+  while(GCLK->STATUS.bit.SYNCBUSY);
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_WDT | GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK2;
+
+  WDT->CONFIG.reg = WDT_CONFIG_PER(WATCHDOG_PERIOD);
+  while(WDT->STATUS.bit.SYNCBUSY);
+  WDT->CTRL.reg = WDT_CTRL_ENABLE;
+  while(WDT->STATUS.bit.SYNCBUSY);
+}
+
+//  Restart the watchdog period
+//  Skipped while the last kick is still synchronising to the slow clock rather than wait for it
+//
+void watchdogKick() {
+  if(!WDT->STATUS.bit.SYNCBUSY) WDT->CLEAR.reg = WDT_CLEAR_CLEAR_KEY;
+}
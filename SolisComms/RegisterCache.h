@@ -9,27 +9,78 @@
     not the number of clients making requests.
 
     At 9600 bps it takes around 1 second per register value retrieval
+
+    Registers on other modbus devices on the bus are keyed device << 16 | address,
+    the inverter on MODBUS_DEVICE keeps plain addresses so its keys are unchanged
     
     R.A.Lincoln       July 2022
 
 */
 
 #define CACHE_OLD 1000*60*2                   // if a register is not requested for a while remove it
-#define CACHE_SIZE 20                         // register cache table across all clients
+#define CACHE_INUSE 30000                     // requested this recently - not replaced by a new address
+#define CACHE_REPEAT 1000                     // requested again this long after being added - promoted
+#ifndef CACHE_SIZE
+#define CACHE_SIZE 64                         // register cache table across all clients
+#endif
+#define CACHE_HOT (CACHE_SIZE * 3 / 4)        // most entries in the protected queue
+#ifndef CACHE_HASH
+#define CACHE_HASH 128                        // address hash table slots, power of 2 at least 2x CACHE_SIZE
+#endif
+#define KEY_DEVICE 16                         // bits of a register key below the device id
+
+#if CACHE_HASH < 2 * CACHE_SIZE || (CACHE_HASH & (CACHE_HASH -1)) != 0
+#error "CACHE_HASH must be a power of 2 at least 2x CACHE_SIZE"
+#endif
+
+//  Cache entry index, a byte unless the cache is too big for one
+#if CACHE_SIZE < 255
+typedef byte cacheIndex;
+#define CACHE_NONE 0xFF                       // no entry - end of list/empty hash slot
+#else
+typedef word cacheIndex;
+#define CACHE_NONE 0xFFFF
+#endif
 
 #define STATE_NULL  0                         // no record ever returned
 #define STATE_VALID 1                         // data is good
 #define STATE_ERROR 2                         // modbus/rs485 threw an error on retreival
+#define STATE_FULL  3                         // not collected, the cache is full of registers in use
+
+#define CACHE_NEW 0                           // probation queue, requested once
+#define CACHE_PROTECTED 1                     // requested again, replaced after the probation queue
+
+#define REG_INTERVAL 0x01                     // refresh interval requested by a client, not learned
+#define REG_SOLO 0x02                         // failed in a block read, read on its own until a good read
+#define REG_VIRTUAL 0x04                      // computed from other registers, not read from the inverter
+#define REG_PIN 0x08                          // pinned, never replaced or expired
 
 //  Local register cache
 struct {
     byte state;                               // entry status STATE_
     unsigned long age;                        // millis last time this register was requested
-    int address;                              // Register base address
+    int address;                              // Register key, base address and device
     int size;                                 // 1 or 2 registers
     long value;                               // Register value - enuogh space for a double register
+    unsigned long sampled;                    // millis last time the value was collected
+    unsigned long version;                    // cacheSequence when the value or state last changed
+    unsigned long interval;                   // ms between reads from the inverter
+    unsigned long due;                        // millis next read is due
+    unsigned long lease;                      // millis a client asked for it to be kept until
+    unsigned long reads;                      // reads from the inverter, for /metrics
+    unsigned long errors;                     // of which failed
+    byte flags;                               // REG_
+    byte failures;                            // consecutive failed reads
+    byte queue;                               // CACHE_NEW or CACHE_PROTECTED
+    cacheIndex older;                         // LRU list links, or next free entry
+    cacheIndex newer;
 } regCache[CACHE_SIZE];
 
+unsigned long cacheSequence;                  // counts every change to any cached value or state
+unsigned long cacheLayout;                    // counts entries added or removed
+
 //  Prototypes
+int registerIndex(int address, int size = -1);
+int registerOwn(int address, int size = -1);
 void setRegister(int address, long data, int state = STATE_VALID);
 void setCache(int i, long data, int state = STATE_VALID);
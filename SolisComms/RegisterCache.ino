@@ -7,112 +7,339 @@
 
     The list is populated by any client requesting a register, then values updated once for all clients periodically
 
+    Admission is 2Q - a new address joins a probation queue, requested again it moves to the protected queue.
+    A new address replaces the least recently requested probation entry, then protected entry, not in use -
+    requested in the last CACHE_INUSE, leased or pinned. If every entry is in use the address is refused,
+    clients see STATE_FULL, so a burst of one off addresses can't push out the dashboard's working set
+    and too many addresses don't endlessly replace each other before any value is read.
+
     R.A.Lincoln       July 2022
 
 */
 
 
+cacheIndex cacheHash[CACHE_HASH];                 // address hash -> cache index, open addressing
+cacheIndex cacheNewest[2];                        // LRU list per queue, most recently requested first
+cacheIndex cacheOldest[2];
+cacheIndex cacheProtected;                        // entries in the protected queue
+cacheIndex cacheFree = CACHE_NONE;                // unused entries, linked through older
+
+//  Empty the cache, all entries onto the free list
+//  Called once from setup
+//
+void cacheBegin() {
+  memset(cacheHash, 0xFF, sizeof(cacheHash));              // all CACHE_NONE
+  memset(cacheNewest, 0xFF, sizeof(cacheNewest));
+  memset(cacheOldest, 0xFF, sizeof(cacheOldest));
+  cacheProtected = 0;
+  cacheFree = CACHE_NONE;
+
+  for(int i = CACHE_SIZE -1; i >= 0; i--) cacheRelease(i);
+}
+
 //  Return the cache index for the passed address - ready for get or set Register
 //  If size is passed it is updated, otherwise defaults to 1
+//  A new address takes a free entry or replaces one not in use, -1 if there are none
 //
-int registerIndex(int address, int size = -1) {
-  unsigned long now = millis();
+int registerIndex(int address, int size) {
 
   //  Is it already in the list?
   //
-  for(int i = 0; i < CACHE_SIZE; i++) {
-    if(regCache[i].address != address) continue;  // Ignore until we find it    
+  int i = cacheFind(address);
+  if(i != -1) {
     if(size != -1) regCache[i].size = size;       // update size if passed
+    metrics.cacheHits++;
     return i;
   }
+  metrics.cacheMisses++;
 
-  // If I didn't find it, find the oldest entry
+  //  If I didn't find it, take a free entry or replace one
   //
-  int found = 0;
-  unsigned long oldest = now;
-
-  for(int i = 0; i<CACHE_SIZE; i++) {             // check all cache entries
-    if(regCache[i].age < oldest) {
-      oldest = regCache[i].age;
-      found = i;
+  if(cacheFree == CACHE_NONE) {
+    i = cacheVictim();
+    if(i == -1) {
+      metrics.cacheRejected++;
+      return -1;                                  // over capacity
     }
+    cacheDelete(i);
+    metrics.cacheEvictions++;
   }
+  i = cacheFree;
+  cacheFree = regCache[i].older;
 
   //  Store the address register entry
   //
   if(size == -1) size = 1;                        // if not passed, default to size=1
-  regCache[found] = {STATE_NULL, now, address, size, 0};
+  regCache[i].age = millis();
+  regCache[i].address = address;
+  regCache[i].size = size;
+  regCache[i].interval = POLL_DEFAULT;
+  regCache[i].due = millis();                     // due straight away
+  if(virtualFind(address) != -1) regCache[i].flags = REG_VIRTUAL;
+
+  int h = cacheSlot(address);                     // first empty slot from its hash
+  while(cacheHash[h] != CACHE_NONE) h = (h +1) & (CACHE_HASH -1);
+  cacheHash[h] = i;
+
+  lruPush(i);
+  cacheLayout++;
+  storeDirty = true;                              // register set changed
+  return i;                                       // return the registers's cache index
+}
+
+//  Cache index for a register the sketch keeps for itself - history, rules and virtual inputs
+//  Found without counting as a client lookup, added if new, -1 with the cache full
+//
+int registerOwn(int address, int size) {
+  int i = cacheFind(address);
+  return i != -1 ? i : registerIndex(address, size);
+}
+
+//  Register keys
+//  The key for a device and address, the MODBUS_DEVICE keys are plain addresses
+//
+int registerKey(int device, int address) {
+  if(device == MODBUS_DEVICE) device = 0;
+  return device << KEY_DEVICE | (address & 0xFFFF);
+}
+
+int registerDevice(int key) {
+  return key >> KEY_DEVICE == 0 ? MODBUS_DEVICE : key >> KEY_DEVICE;
+}
+
+int registerAddress(int key) {
+  return key & 0xFFFF;
+}
+
+//  Print a key as <address> or <device>:<address>
+//
+void printRegister(Print &out, int key) {
+  if(key >> KEY_DEVICE != 0) {
+    out.print(key >> KEY_DEVICE);
+    out.write(':');
+  }
+  out.print(key & 0xFFFF);
+}
+
+//  Return the cache index for the address, or -1 if not cached
+//
+int cacheFind(int address) {
+  for(int h = cacheSlot(address); cacheHash[h] != CACHE_NONE; h = (h +1) & (CACHE_HASH -1)) {
+    if(regCache[cacheHash[h]].address == address) return cacheHash[h];
+  }
+  return -1;
+}
+
+//  Home hash slot for an address - multiplicative hash, 33xxx addresses are clustered
+//
+int cacheSlot(int address) {
+  return ((unsigned long)address * 2654435761UL >> 16) & (CACHE_HASH -1);
+}
+
+//  Least recently requested entry not in use, probation queue first, or -1
+//
+int cacheVictim() {
+  for(int q = CACHE_NEW; q <= CACHE_PROTECTED; q++) {
+    for(int i = cacheOldest[q]; i != CACHE_NONE; i = regCache[i].newer) {
+      if(millis() - regCache[i].age >= CACHE_INUSE && !cacheKept(i)) return i;
+    }
+  }
+  return -1;
+}
+
+//  True if pinned or leased
+//
+bool cacheKept(int i) {
+  return (regCache[i].flags & REG_PIN) || (long)(regCache[i].lease - millis()) > 0;
+}
+
+//  Mark an entry as just requested, most recent in its LRU list
+//  A probation entry requested again is promoted, the oldest protected entry going back on probation to make room
+//
+void cacheTouch(int i) {
+  if(i == -1) return;
+  bool repeat = millis() - regCache[i].age >= CACHE_REPEAT;
+  regCache[i].age = millis();
+  lruUnlink(i);
+
+  if(regCache[i].queue == CACHE_NEW && repeat) {
+    if(cacheProtected == CACHE_HOT) {
+      int j = cacheOldest[CACHE_PROTECTED];
+      lruUnlink(j);
+      regCache[j].queue = CACHE_NEW;
+      lruPush(j);
+    }
+    regCache[i].queue = CACHE_PROTECTED;
+  }
+  lruPush(i);
+}
 
-  return found;                                   // return the registers's cache index
+//  Add an entry as the newest in its queue's LRU list
+//
+void lruPush(int i) {
+  byte q = regCache[i].queue;
+  regCache[i].older = cacheNewest[q];
+  regCache[i].newer = CACHE_NONE;
+  if(cacheNewest[q] != CACHE_NONE) regCache[cacheNewest[q]].newer = i;
+  else cacheOldest[q] = i;
+  cacheNewest[q] = i;
+  if(q == CACHE_PROTECTED) cacheProtected++;
 }
 
-//  Return the current value of a register
+//  Remove an entry from its queue's LRU list
+//
+void lruUnlink(int i) {
+  byte q = regCache[i].queue;
+  cacheIndex older = regCache[i].older;
+  cacheIndex newer = regCache[i].newer;
+  if(older != CACHE_NONE) regCache[older].newer = newer;
+  else cacheOldest[q] = newer;
+  if(newer != CACHE_NONE) regCache[newer].older = older;
+  else cacheNewest[q] = older;
+  if(q == CACHE_PROTECTED) cacheProtected--;
+}
+
+//  Return the current value of a register, 0 if the cache is full
 //  Update aging on all value requests
 //
 long getRegister(int address, int size){
   int i = registerIndex(address, size);
-  regCache[i].age = millis();                     // update age on all requests
+  if(i == -1) return 0;
+  cacheTouch(i);                                  // update age on all requests
+  BENCH(if(regCache[i].state == STATE_VALID) benchFreshness(millis() - regCache[i].sampled));
   return regCache[i].value;
 }
 
-//  Append the value of a register to the json string
+//  Write the value of a register as a json name/value pair
 //  Update aging on all value requests
-//   ,"address":<value>" or ""
+//   ,"address":<value>" or nothing
 //
-void getJSON(int address, int size, char *json) {
+void getJSON(int address, int size, HttpWriter &out) {
   int i = registerIndex(address, size);           // find the cache entry
-  regCache[i].age = millis();                     // update age on all requests
+  if(i == -1) return;                             // cache full
+  cacheTouch(i);                                  // update age on all requests
   
   if(regCache[i].state != STATE_VALID) return;    // no data
 
-  char addressS[20], valueS[20];                  // format as strings
-  itoa(address, addressS, 10);                    // base10
-  itoa(regCache[i].value, valueS, 10);
+  out.print(",\"");                               // write the json entry
+  out.writeLong(address);
+  out.print("\":");
+  out.writeLong(regCache[i].value);
+}
+
+//  Set a client requested refresh interval in ms, 0 to leave it learning
+//  The fastest interval requested by any client wins
+//
+void registerInterval(int i, unsigned long interval) {
+  if(interval == 0 || i == -1) return;
+  if((regCache[i].flags & REG_INTERVAL) && interval >= regCache[i].interval) return;
+
+  regCache[i].interval = interval;
+  regCache[i].flags |= REG_INTERVAL;
+  storeDirty = true;
 
-  strcat(json, ",\"");                            // construct the json entry
-  strcat(json, addressS);
-  strcat(json, "\":");
-  strcat(json, valueS);
+  unsigned long due = millis() + interval;
+  if((long)(regCache[i].due - due) > 0) regCache[i].due = due;  // bring forward
+}
+
+//  Keep a register for at least lease ms without it being requested, 0 for no lease
+//  The longest lease asked for by any client wins
+//
+void registerLease(int i, unsigned long lease) {
+  if(lease == 0 || i == -1) return;
+  unsigned long until = millis() + lease;
+  if((long)(until - regCache[i].lease) > 0 || !cacheKept(i)) regCache[i].lease = until;
+}
+
+//  Pin a register, kept until stopped
+//
+void registerPin(int i) {
+  if(i == -1 || (regCache[i].flags & REG_PIN)) return;
+  regCache[i].flags |= REG_PIN;
+  storeDirty = true;
 }
 
 //  Set a register value in cache from its address
 //
 void setRegister(int address, long value, int state) {
   int i = registerIndex(address);
-  setCache(i, value, state);
+  if(i != -1) setCache(i, value, state);
 }
 
 //  Set a register value from its index
+//  A different value or state gets the next sequence number as its version
 //
 void setCache(int i, long value, int state) {
+  if(regCache[i].value != value
+  || regCache[i].state != state) regCache[i].version = ++cacheSequence;
+
   regCache[i].value = value;
   regCache[i].state = state;
+  regCache[i].sampled = millis();
 }
 
 //  Stop collecting the passed address
-//  If the register wasn't collecting this will enter it then remove
 //
 void stopRegister(int address) {
-  int i = registerIndex(address);   // find it
-  cacheDelete(i);                   // remove it
+  int i = cacheFind(address);       // find it
+  if(i != -1) cacheDelete(i);       // remove it
 }
 
 void stopAll() {
   for(int i = 0; i < CACHE_SIZE; i++) {
-    cacheDelete(i);
+    if(regCache[i].address != 0) cacheDelete(i);
   }
 }
 
-//  Check the cache entry age, if old - remove it
+//  Check the oldest entry age in each queue, if old - remove it
 //  Implies it has not been accessed in CACHE_OLD millis
+//  Pinned and leased entries go round again as newest
 //
-void cacheAgeCheck(int i) {
-  if(millis() - regCache[i].age < CACHE_OLD) return;  // still inside the age limit
-  cacheDelete(i);                                     // old entry - remove it
+void cacheAgeCheck() {
+  for(int q = CACHE_NEW; q <= CACHE_PROTECTED; q++) {
+    int i = cacheOldest[q];
+    if(i == CACHE_NONE) continue;                               // empty
+    if(millis() - regCache[i].age < CACHE_OLD) continue;        // still inside the age limit
+
+    if(cacheKept(i)) {
+      regCache[i].age = millis();
+      lruUnlink(i);
+      lruPush(i);
+    } else {
+      cacheDelete(i);                                           // old entry - remove it
+      metrics.cacheExpired++;
+    }
+  }
 }
 
 //  Discard a cache entry completely
+//  Later entries in the same hash run are shifted back so lookups never see a gap
 //
 void cacheDelete(int i) {
-  regCache[i] = {STATE_NULL, 0, 0, 0, 0};
+  int h = cacheSlot(regCache[i].address);
+  while(cacheHash[h] != i) h = (h +1) & (CACHE_HASH -1);
+
+  for(int j = (h +1) & (CACHE_HASH -1); cacheHash[j] != CACHE_NONE; j = (j +1) & (CACHE_HASH -1)) {
+    int home = cacheSlot(regCache[cacheHash[j]].address);
+    bool stays = h < j ? (home > h && home <= j)  // home slot cyclically within (h, j]
+                       : (home > h || home <= j);
+    if(stays) continue;
+    cacheHash[h] = cacheHash[j];                  // fill the gap
+    h = j;
+  }
+  cacheHash[h] = CACHE_NONE;
+
+  lruUnlink(i);
+  cacheRelease(i);
+  cacheLayout++;
+  storeDirty = true;
+}
+
+//  Clear an entry onto the free list
+//
+void cacheRelease(int i) {
+  memset(&regCache[i], 0, sizeof(regCache[i]));
+  regCache[i].older = cacheFree;
+  regCache[i].newer = CACHE_NONE;
+  cacheFree = i;
 }
@@ -0,0 +1,41 @@
+/*
+
+    Rules.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define RULE_TIMEOUT 5000                     // ms to connect and get a response from the device
+#define RULE_RETRY 10000                      // ms before resending a change that wasn't delivered
+
+#define RULE_UNKNOWN 0                        // rule output states
+#define RULE_OFF 1
+#define RULE_ON 2
+
+#define SEND_IDLE 0                           // outbound request states
+#define SEND_CONNECTING 1
+#define SEND_WAITING 2
+
+//  An output switched on and off by conditions, the gap between them gives hysteresis
+//
+struct ruleDefinition {
+    const char *name;
+    const char *on;                           // expression, true switches on
+    const char *off;                          // expression, true switches off
+    IPAddress host;                           // device told about changes
+    int port;
+    const char *path;                         // request path, true or false appended
+};
+
+//  Compiled conditions and where the rule is up to
+//
+struct ruleState {
+    expression on;
+    expression off;
+    byte state;                               // RULE_
+    bool pending;                             // change not yet delivered
+    unsigned long evaluated;                  // cacheSequence when last evaluated
+    unsigned long retry;                      // millis a failed delivery can be retried
+};
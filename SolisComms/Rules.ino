@@ -0,0 +1,175 @@
+/*
+
+    Rules
+    https://github.com/RichardL64
+
+    Switch other devices from register values, pushed from here rather than each device polling /R
+
+    Each rule has on and off conditions, Expressions over registers, evaluated after a poll when one of their
+    registers has changed. A change of state sends one HTTP GET to the device, e.g. a Shelly Switch.Set,
+    so it reacts within a poll cycle. Delivery doesn't hold up the loop - the connection is started and
+    then checked each pass, failures are retried every RULE_RETRY until the device takes it.
+
+    The first decision after boot is always sent so the device agrees with the rule.
+
+    Test against a stand-in server by pointing a rule at a PC, e.g. python3 -m http.server 8080
+    and watch for the requests in its log.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Rule definitions
+//  A rule with no host is off until configured
+//  The immersion relay is switched by the Shelly Plus1/SOC script polling /R, give the rule the Shelly's
+//  fixed IP (mDNS not working), e.g. IPAddress(192, 168, 1, 144), and stop that script to switch it from here instead
+//
+const ruleDefinition ruleTable[] = {
+  //  name        on                                      off
+  {"immersion", "r33139 >= 95 and r33057.2 >= 100", "r33139 <= 90 or r33057.2 < 100",
+    IPAddress(), 80, "/rpc/Switch.Set?id=0&on="},
+};
+#define RULE_COUNT (sizeof(ruleTable) / sizeof(ruleTable[0]))
+
+ruleState rules[RULE_COUNT];
+
+WiFiClient ruleClient;                        // outbound connection
+byte ruleSending;                             // SEND_
+int ruleSent;                                 // rule being delivered
+byte ruleSentState;                           // state being delivered
+unsigned long ruleStarted;                    // millis delivery started
+
+//  Compile the rule conditions
+//  Called from setup
+//
+void ruleBegin() {
+  for(unsigned int r = 0; r < RULE_COUNT; r++) {
+    if(ruleTable[r].host == IPAddress()) continue;          // not configured, never fires
+    if(!exprCompile(ruleTable[r].on, rules[r].on)
+    || !exprCompile(ruleTable[r].off, rules[r].off)) {
+      memset(&rules[r], 0, sizeof(rules[r]));               // never fires
+      LOG_E("Rule error %s", ruleTable[r].name);
+    }
+  }
+}
+
+//  Re-evaluate rules whose registers changed, queueing any change of state
+//  Rule registers are kept in the cache permanently
+//  Called from the main loop after each poll
+//
+void ruleUpdate() {
+  for(unsigned int r = 0; r < RULE_COUNT; r++) {
+    ruleState &rs = rules[r];
+    bool changed = rs.evaluated == 0;
+    if(ruleInputs(rs.on, rs.evaluated)) changed = true;
+    if(ruleInputs(rs.off, rs.evaluated)) changed = true;
+    if(!changed) continue;
+
+    rs.evaluated = cacheSequence;
+    long on = 0, off = 0;
+    if(exprEvaluate(rs.on, on) != STATE_VALID
+    || exprEvaluate(rs.off, off) != STATE_VALID) continue;  // no data - no decision
+
+    byte next = rs.state;
+    if(rs.state != RULE_ON && on) next = RULE_ON;
+    else if(rs.state != RULE_OFF && off) next = RULE_OFF;
+    if(next == rs.state) continue;
+
+    rs.state = next;
+    rs.pending = true;
+    rs.retry = millis();
+
+    LOG_I("Rule %s %s", ruleTable[r].name, next == RULE_ON ? "on" : "off");
+  }
+}
+
+//  Keep an expression's registers cached, pinned
+//  Returns true if any changed after the since sequence
+//
+bool ruleInputs(expression &e, unsigned long since) {
+  bool changed = false;
+  for(int n = 0; n < e.inputs; n++) {
+    int i = registerOwn(e.input[n], e.size[n]);
+    if(i == -1) continue;                                   // cache full, evaluates as no data
+    registerPin(i);
+    if(regCache[i].version > since) changed = true;
+  }
+  return changed;
+}
+
+//  Move any delivery on a step, never waits
+//  Called from the main loop
+//
+void ruleService() {
+  switch(ruleSending) {
+    case SEND_IDLE:
+      if(netState != NET_UP) return;                        // nowhere to send it yet
+      for(unsigned int r = 0; r < RULE_COUNT; r++) {
+        if(rules[r].pending && (long)(millis() - rules[r].retry) >= 0) {
+          ruleConnect(r);
+          return;
+        }
+      }
+      return;
+
+    case SEND_CONNECTING:
+      if(ruleClient.connected()) {
+        const ruleDefinition &rd = ruleTable[ruleSent];
+        ruleClient.print(F("GET "));
+        ruleClient.print(rd.path);
+        ruleClient.print(ruleSentState == RULE_ON ? F("true") : F("false"));
+        ruleClient.print(F(" HTTP/1.1\r\nHost: "));
+        ruleClient.print(rd.host);
+        ruleClient.print(F("\r\nConnection: close\r\n\r\n"));
+        ruleSending = SEND_WAITING;
+
+      } else if(millis() - ruleStarted > RULE_TIMEOUT) {
+        ruleDone(false);
+      }
+      return;
+
+    case SEND_WAITING:
+      if(ruleClient.available() >= 12) {                   // HTTP/1.1 200
+        char status[13];
+        ruleClient.read((uint8_t *)status, 12);
+        status[12] = '\0';
+        ruleDone(strncmp(status + 9, "2", 1) == 0);
+
+      } else if(millis() - ruleStarted > RULE_TIMEOUT
+             || !ruleClient.connected()) {
+        ruleDone(false);
+      }
+      return;
+  }
+}
+
+//  Start connecting to the rule's device
+//  WiFiClient.connect() waits for the connection, starting it directly doesn't
+//
+void ruleConnect(int r) {
+  uint8_t sock = ServerDrv::getSocket();
+  if(sock == NO_SOCKET_AVAIL) return;                       // try again next loop
+
+  ServerDrv::startClient(uint32_t(ruleTable[r].host), ruleTable[r].port, sock);
+  ruleClient = WiFiClient(sock);
+  ruleSending = SEND_CONNECTING;
+  ruleSent = r;
+  ruleSentState = rules[r].state;
+  ruleStarted = millis();
+}
+
+//  Finish a delivery, retrying later if it failed
+//  The state may have changed again while it was being sent
+//
+void ruleDone(bool good) {
+  ruleClient.stop();
+  ruleSending = SEND_IDLE;
+
+  ruleState &rs = rules[ruleSent];
+  if(good) {
+    if(rs.state == ruleSentState) rs.pending = false;
+  } else {
+    rs.retry = millis() + RULE_RETRY;
+    LOG_W("Rule send failed %s", ruleTable[ruleSent].name);
+  }
+}
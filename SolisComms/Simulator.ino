@@ -0,0 +1,123 @@
+/*
+
+    Simulator
+    https://github.com/RichardL64
+
+    Stand in for the inverter, built with SIMULATE_INVERTER defined
+    Runs the poll loop and web server on a bare board - no RS485 hardware or inverter needed
+
+    Serves the 33xxx input register map as devices 1 and 2, at the byte level in place of the RS485 port.
+    Request frames from ModbusRtu are CRC checked and answered with a response frame that arrives a byte
+    per char time at 9600 bps, 8N1 = 10 bits per char, after the inverter turnaround.
+    Reads outside the map return an exception like the real inverter, a bad frame gets no answer.
+    Setting simFail garbles the next response covering that address, as a noisy bus would.
+
+    Values follow a compressed SIM_DAY second solar day so the dashboard moves.
+    For the last SIM_ASLEEP of the night the inverter doesn't answer at all, each read waits out the modbus timeout.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#ifdef SIMULATE_INVERTER
+
+#define SIM_CHAR_US 1042                      // us per char at 9600 bps
+#define SIM_TURNAROUND 40                     // ms inverter processing before responding
+#define SIM_FIRST 33000                       // simulated input register range
+#define SIM_LAST 33299
+#define SIM_DAY 600                           // seconds per simulated day
+#define SIM_ASLEEP 60                         // seconds before dawn with no response
+#define SIM_DEVICES 2                         // inverters answering, device ids 1...
+
+byte simReply[RTU_FRAME];                     // response frame
+int simLength;                                // bytes in it
+int simSent;                                  // bytes received by the master so far
+unsigned long simStart;                       // micros the response starts
+int simFail;                                  // register address, the next response covering it is garbled
+
+//  A request frame sent on the bus
+//  Prepares the response, if there is one
+//
+void simReceive(const byte *frame, int length) {
+  simLength = simSent = 0;
+
+  word crc = 0xFFFF;
+  for(int b = 0; b < length; b++) crc = crc16(crc, frame[b]);
+  if(length != 8 || crc != 0) return;                       // garbled - ignored
+  if(millis() / 1000 % SIM_DAY >= SIM_DAY - SIM_ASLEEP      // asleep
+  || frame[0] == 0 || frame[0] > SIM_DEVICES) return;       // nothing there
+
+  int address = frame[2] << 8 | frame[3];
+  int count = frame[4] << 8 | frame[5];
+  simReply[simLength++] = frame[0];
+
+  if(frame[1] != RTU_READ_INPUT
+  || count < 1 || count > MODBUS_MAX_READ
+  || address < SIM_FIRST || address + count -1 > SIM_LAST) {
+    simReply[simLength++] = frame[1] | 0x80;                // exception, illegal data address
+    simReply[simLength++] = 2;
+  } else {
+    simReply[simLength++] = frame[1];
+    simReply[simLength++] = 2 * count;
+    for(int r = 0; r < count; r++) {
+      word value = simRegister(address + r);
+      simReply[simLength++] = value >> 8;
+      simReply[simLength++] = value;
+    }
+  }
+
+  crc = 0xFFFF;
+  for(int b = 0; b < simLength; b++) crc = crc16(crc, simReply[b]);
+  simReply[simLength++] = crc;
+  simReply[simLength++] = crc >> 8;
+  if(simFail >= address && simFail < address + count) {    // a one off CRC error
+    simReply[simLength -1] ^= 0xFF;
+    simFail = 0;
+  }
+
+  simStart = micros() + length * SIM_CHAR_US + SIM_TURNAROUND * 1000UL;   // request on the wire, then turnaround
+}
+
+//  Next response byte to have arrived, -1 if none
+//
+int simRead() {
+  if(simSent == simLength) return -1;
+  if((long)(micros() - (simStart + (simSent +1) * SIM_CHAR_US)) < 0) return -1;   // still on the wire
+  return simReply[simSent++];
+}
+
+//  Simulated register value
+//  Double registers are split high/low across address, address +1
+//
+word simRegister(int address) {
+  long phase = millis() / 1000 % SIM_DAY;                   // 0 ... SIM_DAY -1
+  long solar = 3500 * sin(PI * 2 * phase / SIM_DAY - PI / 2);
+  solar = max(solar, (long)0);                              // night half of the day
+  long house = 400 + phase % 7 * 50;
+  long soc = 20 + 80 * phase / SIM_DAY;                     // % 
+  long battery = solar - house;                             // +ve charging
+  long grid = soc >= 100 ? battery : 0;                     // export once full
+
+  switch(address) {
+    case 33035: return phase * 300 / SIM_DAY;               // generation today 0.1 kWh
+    case 33036: return 250;                                 // generation yesterday
+    case 33057: return solar >> 16;                         // solar W
+    case 33058: return solar;
+    case 33093: return 350 + phase % 5;                     // temperature 0.1 C
+    case 33130: return grid >> 16;                          // grid W, +ve export
+    case 33131: return grid;
+    case 33135: return battery < 0 ? 1 : 0;                 // 0 charge, 1 discharge
+    case 33139: return soc;                                 // battery SOC %
+    case 33147: return house;                               // house load W
+    case 33149: return abs(battery) >> 16;                  // battery W
+    case 33150: return abs(battery);
+    case 33163: return phase * 60 / SIM_DAY;                // battery charge today 0.1 kWh
+    case 33167: return phase * 20 / SIM_DAY;                // battery discharge today
+    case 33171: return 12;                                  // grid import today
+    case 33175: return phase * 40 / SIM_DAY;                // grid export today
+    case 33179: return phase * 90 / SIM_DAY;                // house load today
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,30 @@
+/*
+
+    Snapshot.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define SNAPSHOT_ALIGN 500                    // ms, registers due this soon after a cycle starts are read in it
+
+//  A register as it was at the end of a poll cycle
+//
+struct snapshotValue {
+    int address;                              // Register key, 0 none
+    long value;
+    byte state;                               // STATE_
+    unsigned long sampled;                    // millis the value was collected
+    unsigned long version;                    // cacheSequence when the value or state last changed
+};
+
+//  The latest complete poll cycle, by cache index, served by /R
+//  regCache is the back buffer, filled a span at a time, copied here whole at the end of each cycle
+//
+struct {
+    unsigned long cycle;                      // counts cycles published
+    unsigned long sequence;                   // cacheSequence when published
+    unsigned long taken;                      // millis published
+    snapshotValue entry[CACHE_SIZE];
+} snapshot;
@@ -0,0 +1,66 @@
+/*
+
+    Snapshot
+    https://github.com/RichardL64
+
+    Coherent register values for /R, a snapshot published at the end of each poll cycle
+
+    Registers are read a span at a time, so between reads the cache mixes values from before and after
+    a change - e.g. solar up but house load not yet, and a derived figure glitches.
+    A cycle starts with the first read after a snapshot and ends once every register that was due then,
+    or within SNAPSHOT_ALIGN, has been read, the new values then replace the snapshot in one go. /R serves the snapshot with its
+    cycle id, and the age of each value on request, so a client never sees half a cycle.
+
+    Registers on a device with its breaker open don't hold up the cycle, they stay in error.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+unsigned long snapshotStart;                  // millis the cycle being collected started
+bool snapshotReading;                         // a cycle is being collected
+
+//  Start a cycle if one isn't being collected
+//  Called from pollNext before each read
+//
+void snapshotBegin() {
+  if(snapshotReading) return;
+  snapshotReading = true;
+  snapshotStart = millis();
+}
+
+//  Publish the cycle if every register due at its start has been read
+//  Called from pollNext after each read
+//
+void snapshotUpdate() {
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address == 0 || (regCache[i].flags & REG_VIRTUAL)) continue;
+    if((long)(regCache[i].due - snapshotStart) > SNAPSHOT_ALIGN) continue;   // read since, or not due in the cycle
+
+    busDevice *dev = busFind(registerDevice(regCache[i].address));
+    if(dev != 0 && dev->probe == 0) return;                             // still to read
+  }
+
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    snapshotValue &s = snapshot.entry[i];
+    s.address = regCache[i].address;
+    s.value = regCache[i].value;
+    s.state = regCache[i].state;
+    s.sampled = regCache[i].sampled;
+    s.version = regCache[i].version;
+  }
+  snapshot.cycle++;
+  snapshot.sequence = cacheSequence;
+  snapshot.taken = millis();
+  snapshotReading = false;
+
+  eventsPush();                                             // tell event streams about any changes
+}
+
+//  The snapshot of a register, 0 if it wasn't cached at the end of the last cycle
+//
+snapshotValue *snapshotFind(int address) {
+  int i = cacheFind(address);
+  if(i == -1 || snapshot.entry[i].address != address) return 0;
+  return &snapshot.entry[i];
+}
@@ -14,7 +14,7 @@
     SPI
     WiFiNINA
     MDNS_Generic
-    Arduino_Modbus
+    ArduinoRS485
 
 
   Poll the inveter for values periodically
@@ -32,13 +32,49 @@
   /H                              Turn the onboard LED on
   /L                              Turn the onboard LED off
 
+  /H?minutes=<m/h/d>&address=<value>,<value>...
+                                  Keep 5 minute (m), hourly (h) or daily (d) min/mean/max history of the registers
+
+  /Q?range=<m/h/d>&count=<n>&address=<value>
+                                  Return the kept history as JSON, oldest first, optionally only the newest n points
+                                  {"address":33057,"range":"m","period":300,"age":12,"data":[[<mean>,<min>,<max>],...]}
+
   /AP?ssid=<value>&password=<value>
                                   Access point mode - Change the network connection credentials
 
   /R?refresh=<seconds>&address=<value>,<value>...   
                                   Return the register addresse values as JSON JS array
                                   <value>.1 or <value>.2 for single/double address registers
+                                  <device>:<value> for a register on another modbus device on the bus, e.g. 2:33057.2
                                   If the optional Refresh setting is passed the page will auto refresh
+                                  <value>@<seconds>s or @<ms>ms requested refresh interval from the inverter, otherwise learned
+                                  &lease=<seconds> before address keeps the registers that long without asking again
+                                  Addresses not cached as the cache is full of registers in use are null, with "error":"cache full"
+                                  Values are from the snapshot at the end of the last poll cycle, {"cycle":57,"data":[...]}
+                                  &age=1 before address adds ms since each value was read, "age":[830,2150,null]
+
+  /R?since=<seq>&address=<value>,<value>...
+                                  Only the values changed after sequence seq, by address, with the sequence for next time
+                                  {"cycle":57,"seq":1234,"data":{"33057":262,"33070":null}}
+
+  /B?address=<value>,<value>...
+                                  As /R in a fixed binary layout for machine clients, little endian
+                                  uint32 sequence, uint32 age ms of the oldest value, uint16 count,
+                                  then per address int32 value, uint8 state 0 null, 1 valid, 2 error, 3 cache full
+
+  /events?address=<value>,<value>...
+                                  Server-Sent Events stream of the register values as JSON JS array
+                                  Pushed at the end of a poll cycle only when a value changed
+
+  /V?address=<value>&expr=<expression>
+                                  Define a virtual register computed from others, served by /R etc like a real one
+                                  e.g. /V?address=33305&expr=r33149.2*(1-2*r33135)   empty expr removes, /V lists them
+
+  /metrics                        Loop, modbus, HTTP & cache counters and timings in Prometheus text format
+
+  /log                            Recent log lines as text, oldest first, "<millis> <E/W/I/D> <message>"
+
+  /P?address=<value>,<value>...   Pin register addresses, kept until stopped, never replaced by other requests
 
   /S?address=<value>              Stop returning a register address
 
@@ -48,7 +84,7 @@
 
   e.g.
   Request
-  GET	R/?addr=33057.2,33070
+  GET	/R?address=33057.2,33070
 
   Response JSON parsable JS object with address/data pairs
   Null value if no available data from the server
@@ -72,9 +108,28 @@
 #include <SPI.h>
 #include <WiFiNINA.h>                           // (note _generic version locks up on closed connections)
 #include <MDNS_Generic.h>
-#include <ArduinoModbus.h>
+#include <ArduinoRS485.h>
+#include <utility/server_drv.h>                // non blocking outbound connections, see Rules
+#include <utility/wifi_drv.h>                  // non blocking network join, see Network
 
+//  Test builds - uncomment to enable
+//#define SIMULATE_INVERTER                     // simulated inverter in place of modbus/rs485, see Simulator
+//#define BENCHMARK                             // refresh, freshness & request rate stats to serial, see Benchmark
+//#define LOG_LEVEL LOG_DEBUG                   // every poll, register value & request to the log, see Log
+
+#include "Log.h"
 #include "RegisterCache.h"
+#include "Snapshot.h"
+#include "ModbusPoll.h"
+#include "ModbusRtu.h"
+#include "Benchmark.h"
+#include "History.h"
+#include "Expression.h"
+#include "Virtual.h"
+#include "Rules.h"
+#include "Store.h"
+#include "Network.h"
+#include "Metrics.h"
 #include "WebServer.h"
 #include "arduino_secrets.h"                    // defines SECRET_SSID, SECRET_PASS
 
@@ -104,7 +159,6 @@ MDNS mdns(udp);
 /*
  * 
  *  Setup
- *  May be re-called by the main loop if connectivity drops
  *  
  */
 void setup() {
@@ -115,50 +169,25 @@ void setup() {
 
   String fv = WiFi.firmwareVersion();               // Wifi Firmware check
   if (fv < WIFI_FIRMWARE_LATEST_VERSION) {
-    Serial.println(F("Please upgrade the firmware"));
+    LOG_W("Please upgrade the firmware");
   }
 
   randomSeed(analogRead(0));                        // Random numbers used in test data generation
+  cacheBegin();                                     // empty register cache
+  BENCH(benchLookup());
+  BENCH(benchParse());
 
-  setupWiFi();                                      // Bring WiFi and mDNS up
-  digitalWrite(LED_BUILTIN, HIGH);                  // LED lit during setup - should go out if sucessful
+  virtualBegin();                                   // built in virtual registers
+  ruleBegin();                                      // compile the rule conditions
+  storeBegin();                                     // registers & history from before a power cut
 
-  Serial.println(F("Webserver begin"));             // Bring Webserver up
+  LOG_I("Webserver begin");                         // Bring Webserver up
   server.begin();                              
 
-  Serial.println(F("Modbus begin"));                // Bring Modbus up
-  if (!ModbusRTUClient.begin(9600)) {      
-    Serial.println(F("Modbus RTU Client start failed"));
-    while (true);                                   // lockup
-  }
+  LOG_I("Modbus begin");                            // Bring Modbus up
+  rtuBegin();
 
-  digitalWrite(LED_BUILTIN, LOW);
-}
-
-/*
- * Setup
- * May be called more than once at startup and if the wifi goes down
- * 
- */
-void setupWiFi() {
-
-  digitalWrite(LED_BUILTIN, HIGH);                  // LED lit during setup - should go out if sucessful
-
-  WiFi.setHostname(HOSTNAME);
-  
-  Serial.println(F("WiFi begin"));                  // Bring WiFi up
-  while(WiFi.status() != WL_CONNECTED) {
-    WiFi.begin(SECRET_SSID, SECRET_PASS);           // defined in Arduino_secrets.h
-    delay(4000);
-  }
-  
-  Serial.println(F("mDNS begin"));                  // Advertise as HOSTNAME
-  mdns.begin(WiFi.localIP(), HOSTNAME);
-  mdns.addServiceRecord(SERVICENAME, 80, MDNSServiceTCP);
-
-  printWifiStatus();
-
-  digitalWrite(LED_BUILTIN, LOW);
+  netBegin();                                       // WiFi and mDNS come up from the loop, LED out when joined
 }
  
 /*
@@ -167,53 +196,37 @@ void setupWiFi() {
  * 
  */
 void loop() {
+  BENCH(benchLoop());
+  metricsLoop();
 
   //  Connectivity
+  //  Joins and rejoins without waiting, collection carries on while WiFi is down
   //
-  if(WiFi.status() != WL_CONNECTED) setupWiFi();             // re-connect if disconnected
-  mdns.run();
+  netService();
+
+  unsigned long start = micros();
   serviceWiFi();
+  metricsTime(metrics.wifi, micros() - start);
+  ruleService();                                            // deliver rule changes to other devices
 
   //  Data collection
-  //  Copy down register data values listed in the cache, one entry per loop
+  //  Block read the registers listed in the cache, one span at a time, the loop carrying on while it's read
   //
   static unsigned long lastCollect;
-  static int index;
-  
-  cacheAgeCheck(index);                                     // cull unaccessed cache entries
 
-  int address =  regCache[index].address;
-  if(address != 0
-    && (millis() - lastCollect > MODBUS_DELAY)) {           // if there is an address to collect & not too frequent
-    lastCollect = millis();
-
-    Serial.print(address);
-
-    int size = regCache[index].size;
-    if(!ModbusRTUClient.requestFrom(1, INPUT_REGISTERS, address, size)) {
-        setCache(index, 0, STATE_ERROR);
-
-        Serial.println(F(" = Data error"));
+  rtuService();                                             // modbus read in progress
 
-    } else {                                                // else good data
-        long value = 0;
-        if(size == 2) value = ModbusRTUClient.read() <<16;  // 32 bit High 16
-        value |=  ModbusRTUClient.read();                   // Low 16 bits
-        setCache(index, value);                             // update the real time cache
-        setHistory(address, value);                         // upate history
-
-        Serial.print(F(" = "));
-        Serial.println(value);
-    }
+  cacheAgeCheck();                                          // cull unaccessed cache entries
+  historyTick();                                            // close finished history periods
+  storeTick();                                              // batched writes to flash
 
+  if(millis() - lastCollect > MODBUS_DELAY) {               // not too frequent
+    lastCollect = millis();
+    pollNext();
+    ruleUpdate();                                           // switch other devices on changed values
   }
- 
-  if(address == 101) setCache(index, random(0, 1000));      // Random number test data on 101  
-  if(address == 102) setCache(index, millis());             // Incrementing millis test data on 102
-  
-  index++;                                                  // Next cache entry for next loop
-  index %= CACHE_SIZE;                                      // Limit 0 ... CACHE_SIZE -1  
 
+  logDrain();                                               // log to serial as far as it goes without waiting
   delay(1);
 }
 
@@ -221,23 +234,15 @@ void loop() {
 
 void printWifiStatus() {
   // print the SSID of the network you're attached to:
-  Serial.print(F("SSID: "));
-  Serial.println(WiFi.SSID());
+  LOG_I("SSID: %s", WiFi.SSID());
 
   // print your board's IP address:
-  IPAddress ip = WiFi.localIP();
-  Serial.print(F("IP Address: "));
-  Serial.println(ip);
+  LOG_I("IP Address: %s", logAddress(WiFi.localIP()));
 
   // print the received signal strength:
-  long rssi = WiFi.RSSI();
-  Serial.print(F("Signal strength (RSSI):"));
-  Serial.print(rssi);
-  Serial.println(F(" dBm"));
+  LOG_I("Signal strength (RSSI):%ld dBm", (long)WiFi.RSSI());
   // print where to go in a browser:
-  Serial.print(F("URL http://"));
-  Serial.print(HOSTNAME);
-  Serial.println(F(".local"));
+  LOG_I("URL http://%s.local", HOSTNAME);
 }
 
 //  Example Arduino reset code
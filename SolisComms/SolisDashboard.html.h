@@ -1,617 +1,388 @@
 /*
 
-    Dashboard.html.h
+    SolisDashboard.html.h
     https://github.com/RichardL64
 
     Simple real time Solis Inverter dashboard
 
-    Call back URL is modified to the Arduino actual IP address when is this content is served
-    Call back on mDNS domain name alone was unstable.
+    Generated by SolisDashboard/makeheader.py from SolisDashboard/SolisDashboard.html - do not edit
+    5935 bytes gzip compressed from 17870
 
-    To allow storage in progmeme, cut/paste the HTML between:
-      const char *dashboardHtml = R"====(
-                                  )====";
-
-    Inline with the Arduino code space
-    
     R.A.Lincoln       July 2022
 
 */
-const char *dashboardHtml = R"====(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="utf-8" />
-  <meta name="referrer" content="no-referrer" />
-  <meta name="author" content="Richard Lincoln July 2022" />
-  <meta name="description" content="https://github.com/RichardL64/Solar" />
-  <title>Solar Dashboard</title>
-
-<!--
-
-  Proof of concept dashboard to present Arduino gathered live SOLIS inverter data
-
-  V3.0
-  Circle based gauge construction vs. previous arcs
-  Simplification & removal of external depdencies
-
-  Data download from the server driven asynchronously
-  Screen updates driven by browser animation API
-
-
-  Parameters
-    ?server=solis.local -or- ?server=192.168.1.143
-    Automatically replaced with the live IP addresss when served from the Arduino
-
-
-  Uses and develops gauge drawing ideas from (Thank you):
-    https://www.fullstacklabs.co/blog/creating-an-svg-gauge-component-from-scratch
-    https://github.com/naikus/svg-gauge
-
-
-  R.Lincoln   July 2022
-
--->
-
-
-  <!--
-
-    CSS
-
-  -->
-  <style>
-
-  body {
-    font-family: sans-serif;
-  }
-
-  .border {
-    border:1px solid black;
-  }
-
-  .gTitle {
-    font-size: 50%;
-    font-weight: normal;
-    fill: black;
-    dominant-baseline: hanging;
-    text-anchor: middle;
-  }
-
-  .kW {
-    font-size: 90%;
-    font-weight: normal;
-    fill: black;
-    alignment-baseline: middle;
-    dominant-baseline: middle;
-    text-anchor: middle;
-  }
-
-  .kWh {
-    font-size: 40%;
-    font-weight: normal;
-    fill: black;
-    alignment-baseline: middle;
-    dominant-baseline: middle;
-    text-anchor: middle;
-  }
-
-  .right {
-    text-anchor: end;
-  }
-
-  #gauges {
-    width: 100%;
-    margin: auto;
-    display: grid;
-    grid-template-columns: 1fr 1fr 1fr;
-  }
-
-
-  </style>
-
-</head>
-
-
-
-<!--
-
-  Body
-
--->
-<body>
-
-  <!--
-
-    SVG shape definitions
-
-    Dial geometry:
-        x,y           50, 50              pixels
-
-        Radius                        40  pixels
-        Circumference 2 *Pi *40     = 251 pixels
-                      2 *Pi *31     = 195
-
-        Dial circ.                    210 degrees
-                      251 /360 *210 = 146 pixels
-                      195 /360 *210 = 113
-
-          1% of dial  147 /100      = 1.46
-
-          mid point   147 /2        = 73  pixels
-          rotation    270 -210 /2   = 165 degrees
-
-    Dial control
-        move the stroke       stroke-dasharray  0-146
-        move the tick to top  stroke-dashoffset -73
-        mirror left/right     transform translate & scale
-
-  -->
-  <svg width="0" height="0">
-    <defs>
-      <g id="gauge"
-        stroke-width="8"
-        fill="transparent"
-        transform="rotate(165, 50, 50)">
-        <circle class="track"
-            cx="50" cy="50" r="40"
-            stroke="whitesmoke"
-            stroke-dashoffset="0"
-            stroke-dasharray="146, 251">
-        </circle>
-        <circle class="stroke"
-            cx="50" cy="50" r="40">
-        </circle>
-        <circle class="tick"
-            cx="50" cy="50" r="40"
-            stroke="black"
-            stroke-width="10"
-            stroke-dasharray=".5, 251">
-        </circle>
-      </g>
-
-      <circle id="1020-tick" class="tick"
-          cx="50" cy="50" r="40"
-          transform="rotate(165, 50, 50)"
-          fill="transparent"
-          stroke="darkgrey"
-          stroke-width="8"
-          stroke-dashoffset="-14.6"
-          stroke-dasharray=".5, 14, .5, 251">
-      </circle>
-    </defs>
-  </svg>
-
-
-  <!--
-
-    Guage presentation
-    &#8451;   Degrees C
-
-  -->
-  <div id="gauges">
-
-      <div>
-        <svg viewbox="0 0 100 65">
-          <use id="solarG" href="#gauge"
-            stroke="gold"
-            stroke-dasharray="0, 251">
-          </use>
-          <text class="gTitle" x="50" y="26">Solar</text>
-          <text id="solarGT" class="kW" x="50" y="46">...</text>
-          <text id="solarGT2" class="kWh" x="50" y="59">...</text>
-        </svg>
-      </div>
-
-      <div>
-        <svg viewbox="0 0 100 65">
-          <use id="batteryG" href="#gauge"
-            stroke="darkseagreen"
-            stroke-dashoffset="-73"
-            stroke-dasharray="0, 251"
-            transform="">
-          </use>
-          <text class="gTitle" x="50" y="26">Battery</text>
-          <text id="batteryGT" class="kW" x="50" y="46">...</text>
-          <text id="batteryGTIn" class="kWh right" x="63" y="56"></text>
-          <text id="batteryGTOut" class="kWh right" x="63" y="63"></text>
-        </svg>
-      </div>
-
-      <div>
-        <svg viewbox="0 0 100 65">
-          <use id="gridG" href="#gauge"
-            stroke="orangered"
-            stroke-dashoffset="-73"
-            stroke-dasharray="0, 251"
-            transform="">
-          </use>
-          <text class="gTitle" x="50" y="26">Grid</text>
-          <text id="gridGT" class="kW" x="50" y="46">...</text>
-          <text id="gridGTIn" class="kWh right" x="63" y="56"></text>
-          <text id="gridGTOut" class="kWh right" x="63" y="63"></text>
-        </svg>
-      </div>
-
-      <div>
-        <svg viewbox="0 0 100 65">
-          <use id="houseG" href="#gauge"
-            stroke="cornflowerblue"
-            stroke-dasharray="0, 251"
-            transform="">
-          </use>
-          <text class="gTitle" x="50" y="26">Demand</text>
-          <text id="houseGT" class="kW" x="50" y="46">...</text>
-          <text id="houseGT2" class="kWh" x="50" y="59"></text>
-        </svg>
-      </div>
-
-      <div>
-        <svg viewbox="0 0 100 66">
-          <use id="batterySOCG" href="#gauge"
-            stroke="darkseagreen"
-            stroke-dasharray="0, 251">
-          </use>
-          <text class="gTitle" x="50" y="28">Charge level</text>
-          <text id="batterySOCGT" class="kW" x="50" y="46">...</text>
-          <text id="batterySOCGT2" class="kWh" x="50" y="56"></text>
-          <text id="batterySOCGTH" class="kWh" x="50" y="63"></text>
-          <use href="#1020-tick"</use>
-        </svg>
-      </div>
-
-
-      <div>
-        <svg viewbox="0 0 100 65">
-          <text id="temp" class="kWh right" x="92" y="54"></text>
-          <text id="time" class="kWh right" x="92" y="62"></text>
-        </svg>
-      </div>
-
-  </div>
-
-
-  <!--
-
-    Script
-
-  -->
-  <script>
-
-    //  Inverter register addresses
-    //
-    const SOLAR_R           = 33057;
-    const BATTCD_R          = 33135;          // 0 charge, 1 discharge
-    const BATTERY_R         = 33149;
-    const GRID_R            = 33130;          // +ve export, -ve import
-    const BATTSOC_R         = 33139;
-    const TEMP_R            = 33093;
-
-    const GEN_TODAY_R       = 33035;
-    const GEN_YEST_R        = 33036;
-
-    const CHG_TODAY_R       = 33163;          // 0.1 kWh
-    const CHG_YEST_R        = 33164;
-
-    const DIS_TODAY_R       = 33167;          // 0.1 kWh
-    const DIS_YEST_R        = 33168;
-
-    const GRID_IMP_TODAY_R  = 33171;
-    const GRID_IMP_YEST_R   = 33172;
-    const GRID_EXP_TODAY_R  = 33175;
-    const GRID_EXP_YEST_R   = 33176;
-
-    const HOUSE_R           = 33147;
-    const HOUSE_TODAY_R     = 33179;
-
-    //  Calculated fields
-    //
-    const BATTERY_KWH_R     = 33303;
-    const BATTERY_HOURS_R   = 33304;
-
-    //  various constants
-    //
-    const FETCH_TIMEOUT       = 5000;
-    const SERVER_INTERVAL     = 2000;
-    const FRAME_CHECK         = 1000;
-    const TIMESTAMP_INTERVAL  = 1000;
-    const FRAME_OLD           = 2000;
-    const DATA_OLD            = 5000;
-    const KW_DECIMALS         = 2;
-    const KWH_DECIMALS        = 1;
-    const FPS                 = 30;         // 30 fps is plenty
-    const BATTERY_KWH         = 3.5 *2      // battery total capacity
-
-    //  Chars
-    //
-    const LEFT_ARROW          = "&#8592;";
-    const RIGHT_ARROW         = "&#8594;";
-    const LEFTRIGHT_ARROW     = "&#8596;";
-
-    //  Register request constants
-    //
-    const ADDRESS = [SOLAR_R+.2, GEN_TODAY_R,
-                    BATTERY_R+.2, BATTCD_R, BATTSOC_R, CHG_TODAY_R, DIS_TODAY_R,
-                    GRID_R+.2, GRID_IMP_TODAY_R, GRID_EXP_TODAY_R,
-                    HOUSE_R, HOUSE_TODAY_R,
-                    TEMP_R];
-    const ADDRESS_LENGTH = ADDRESS.length;
-    const ADDRESS_S = "?address=" + ADDRESS.join();
-    console.log(ADDRESS_S);
-
-    //  Globals
-    //
-    let newJson = {};                                       // latest data returned by callServer
-    let newJsonTime = new Date()                            // time data returned by callServer
-    let dispJson = {};                                      // latest data displayed by updateDashboard
-
-    let lastFrame = 0;                                      // only ever one anim frame request at a time
-    let lastFrameTime = new Date();                         // time updateDashboard last called
-
-
-    //  Startup
-    //
-    callServer(SERVER_INTERVAL, serverURL());               // continuous periodic data retrieval
-    setInterval(updateTime, TIMESTAMP_INTERVAL);            // regular timestamp updates
-
-
-    //  Parse the server URL parameter for callbacks
-    //  When served from the arduino the live ip address replaces the hostname
-    //
-    //  Arduino searches for <script> then ** etc then "..."
-    //  Whatever is between the quotes is replaced with the actual IP address
-    //
-    function serverURL() {
-      const queryString = window.location.search;
-      const urlParams = new URLSearchParams(queryString);
-      let url = urlParams.get('server')
-
-      //  *** LIVE IP ADDRESS ***
-      if(url == null) url = "solis.local";
-
-      console.log(url);
-      return url;
-    }
-
-    //  Make sure there is only one animation frame request made at a time
-    //  These all seem to get honoured eventually and backup if called in the background
-    //
-    function requestAnimFrame() {
-        cancelAnimationFrame(lastFrame);
-        lastFrame = requestAnimationFrame(updateDashboard);
-    }
-
-    //  Call the server for a data update & calls itself once the query completes
-    //  When I get new data kick off the dashboard, assuming its stopped animating the previous update
-    //  Variable length async response depending how long the fetch takes
-    //
-    function callServer(freq, url) {
-
-      //  If the last dashboard frame was a while ago - its probably throttled by the browser
-      //  We're probably in the background
-      //  Stop doing the server round trip until the browser will show frames again
-      //
-      if(new Date - lastFrameTime > FRAME_OLD) {
-        console.log("no frames");
-        requestAnimFrame();                                 // see if we can get an anim frame
-        setTimeout(callServer, FRAME_CHECK, freq, url);     // keep checking more frequently
-        return;
-      }
-
-      //  Callback to the server for new data - asynchronous this function could return first
-      //
-      const controller = new AbortController()              // watchdog for max fetch time
-      const fetchTimeout = setTimeout(() => controller.abort(), FETCH_TIMEOUT)
-
-      fetch("http://" + url + "/R" + ADDRESS_S, { signal: controller.signal })
-
-        .then(response => response.json())                  // header
-
-        .then(json => {                                     // body
-          for(let i = 0; i < ADDRESS_LENGTH; i++) {         // convert passed value only to name/value pairs
-            newJson[ADDRESS[i].toFixed(0)] = json["data"][i];
-          };
-          newJsonTime = Date.now();
-          adjustNewJson();
-          console.log(newJson);
-
-          requestAnimFrame();                               // Update the dashboard with new values
-          })
-
-        .catch(err => console.error(err))
-
-        .finally(() => {
-            clearTimeout(fetchTimeout);                     // clear the watchdog
-            setTimeout(callServer, freq, freq, url);        // call myself later
-          });
-    }
-
-    //  Adjust inbound inverter data
-    //  Local changes to newJson - generally +ve = generation, -ve = consumption
-    //
-    //  Performing this before any display means animation etc will work for calculated values
-    //
-    function adjustNewJson() {
-
-          //  Same scale as other values simplifies the change detection
-          //
-          newJson[BATTSOC_R] *= 10;
-          newJson[TEMP_R] *= 10;
-
-          //  Convert battery charge/discharge to a signed value
-          //  -ve = using power to charge
-          //  +ve = supplying power
-          //
-          if(newJson[BATTCD_R] == 1) {                      // Make battery signed - 0=chg, 1=dischg
-            newJson[BATTERY_R] *= -1;
-          }
-          delete newJson[BATTCD_R];
-
-          //  kWh *10 in the battery - hard coded to physical battery capacity
-          //
-          const capacity1 = BATTERY_KWH /100;               // 1% of battery capacity in kWh
-          newJson[BATTERY_KWH_R] = Math.floor(newJson[BATTSOC_R] *capacity1);
-
-          //  Hours battery remaining at the current rate of discharge
-          //  ..to 20% capacity, never goes -ve
-          //
-          let perc80 = Math.max(newJson[BATTERY_KWH_R] /10 - (capacity1 *20), 0);
-          newJson[BATTERY_HOURS_R] = Math.max(perc80 / -newJson[BATTERY_R] *1000, 0);
-          if (newJson[BATTERY_R] ==0) newJson[BATTERY_HOURS_R] = 0;
-    }
-
-
-    //  Update the dashboard
-    //  Once no change is detected, waits on the server response before starting again
-    //  Called by the browser animation API so no fixed frequency
-    //
-    function updateDashboard() {
-      console.log("frames");
-      lastFrameTime = new Date;                             // detect browser slowing screen updates
-
-      //  Move dispJson towards newJson incrementally for each register value
-      //  Ignore completely empty, all zero, datasets
-      //  Keep a record of anything changing so we know when to stop asking for animation frames
-      //  CSS transition is not used because of the mirrored gauges and going through 0
-      //
-      let empty = 0;                                              // posit empty dataset
-      let changes = dispJson[ADDRESS[0].toFixed()] == undefined;  // posit nothing will change, except first time through
-      for(const reg in newJson) {
-        let targetV = newJson[reg];
-        let oldV = dispJson[reg] || targetV;                // first time through take the target value
-        const alpha = .8 /FPS                               // exponential towards the new value @ ~60fps
-        let newV = (alpha * targetV) + ((1- alpha) * oldV);
-        dispJson[reg] = newV;
-
-        empty += targetV;                                   // detect when all of the dataset is 0
-        if(Math.abs(targetV - newV) > 5) changes = true;    // admit something moved significantly
-      }
-      if(!empty || !changes) return;                        // no data or nothing changed --->
-
-      //  Update the gauges from dispJson for smooth transition
-      //
-      setValue("solarG",      0,     4000, dispJson[SOLAR_R],   kW(dispJson[SOLAR_R]));
-      setValue("batteryG",    -3600, 3600, dispJson[BATTERY_R], lrArrow(dispJson[BATTERY_R]) + kW(Math.abs(dispJson[BATTERY_R])));
-      setValue("gridG",       -10000,4000, dispJson[GRID_R],    lrArrow(dispJson[GRID_R]) + kW(Math.abs(dispJson[GRID_R])));
-      setValue("houseG",      0,    10000, dispJson[HOUSE_R],   kW(dispJson[HOUSE_R]));
-      setValue("batterySOCG", 0,     1000, dispJson[BATTSOC_R], (dispJson[BATTSOC_R]/10).toFixed(0) + "%");
-
-      //  Update from newJson for direct to the target value
-      //
-      document.getElementById("solarGT2").innerHTML =       kWh(newJson[GEN_TODAY_R]);
-      document.getElementById("batteryGTIn").innerHTML =    LEFT_ARROW + kWh(newJson[DIS_TODAY_R]);
-      document.getElementById("batteryGTOut").innerHTML =   RIGHT_ARROW + kWh(newJson[CHG_TODAY_R]);
-      document.getElementById("batterySOCGT2").innerHTML =  kWh(newJson[BATTERY_KWH_R]);
-      document.getElementById("batterySOCGTH").innerHTML =  hours(newJson[BATTERY_HOURS_R]);
-      document.getElementById("gridGTIn").innerHTML =       LEFT_ARROW + kWh(newJson[GRID_IMP_TODAY_R]);
-      document.getElementById("gridGTOut").innerHTML =      RIGHT_ARROW + kWh(newJson[GRID_EXP_TODAY_R]);
-      document.getElementById("houseGT2").innerHTML =       kWh(newJson[HOUSE_TODAY_R]);
-      document.getElementById("temp").innerHTML =           "Inverter temp. "+ (newJson[TEMP_R]/100 || 0).toFixed(1) + "&#8451;";
-
-      //  Request more animation frames @ ~n fps
-      //
-      setTimeout(requestAnimFrame, 1000 /FPS, updateDashboard);
-    }
-
-
-    //  Update the time every second
-    //  Warn if the data is getting old
-    //
-    function updateTime() {
-      let now = new Date();
-      if(now - newJsonTime > DATA_OLD) {
-        document.getElementById("time").textContent = "Waiting for data";
-        return;
-      }
-
-      document.getElementById("time").textContent = "Updated at " + now.toLocaleTimeString();
-    }
-
-    //  Returns the label format for passed hours
-    //
-    function hours(val) {
-      if(isNaN(val)) return "...";
-      if(val == 0) return "";                     // charging
-      if(val < 1) return "~ " + Math.round(60 * val) + " mins capacity";
-      return "~ " + Math.round(val*10/5)/10*5 + " hrs capacity";
-//      return "~ " + Math.round(val*2)/50 + " hrs capacity";
-    }
-
-    //  Returns the Label format for kW passed the value in watts
-    //
-    function kW(val) {
-      if(isNaN(val)) return "...";
-      return (val/1000).toFixed(KW_DECIMALS) + "&thinsp;kW";
-    }
-
-    //  Returns the label for kWh passed the value in 10x watt hours
-    //
-    function kWh(val) {
-      if(isNaN(val)) return "...";
-      return (val/10).toFixed(KWH_DECIMALS) + "&thinsp;kWh";
-    }
-
-    //  Format -ve numbers as left arrow, +ve numbers as right arrow
-    //    &#8592;   Left arrow
-    //    &#8594;   Right arrow
-    //    &#8596;   Left/Right arrow
-    //
-    function lrArrow(val) {
-      if(val <= 0) return LEFT_ARROW;
-      if(val >= 0)  return RIGHT_ARROW;
-      return "";
-    }
-
-    //  Set the value and value text for the passed gauge ID
-    //  Updates id elements moving the dial stroke proportionately
-    //
-    //  Where min is -ve the zero point is always at 12 o'clock
-    //  Scales left/right of the central zero point can be different
-    //
-    function setValue(id, min, max, val, label) {
-
-      if(isNaN(val)) return;                      // no value - ignore
-
-      //  Value text
-      //
-      document.getElementById(id + "T").innerHTML = label;
-
-      //  Min is +ve, draw from the left end
-      //
-      if(min >= 0) {                              // From left hand end
-        let pn = toPercent(min, max, val);        // %
-        let v = 1.46 * pn;                        // * 1% of dial
-        document.getElementById(id).setAttribute("stroke-dasharray", v + ", 251");
-        return;
-      }
-
-      //  Min is -ve, value is +ve draw from the middle right
-      //
-      if(val >= 0) {
-        let pn = toPercent(0, max, val);          // % 0...max
-        let v = 1.46 * pn /2;                     // * 1% of half the dial
-        document.getElementById(id).setAttribute("stroke-dasharray", v + ", 251");
-        document.getElementById(id).setAttribute("transform", "");
-        return;
-      }
-
-      // Min is -ve, value is -ve, draw from the middle left and mirror the dial
-      //
-      let pn = toPercent(0, min,  val);           // % min...0
-      let v = 1.46 * pn /2;                       // * 1% of half the dial
-      document.getElementById(id).setAttribute("stroke-dasharray", v + ", 251");
-      document.getElementById(id).setAttribute("transform", "translate(100,0) scale(-1,1)");
-
-    }
-
-    //  Return the value in the min-max range as percent 0-100
-    //
-    function toPercent(min, max, val) {
-      let p = val *100 / (max-min);
-      let pn = Math.min(Math.max(p, 0), 100);     // normalise 0-100
-      return pn;
-    }
-
-  </script>
-</body>
-</html>
-)====";
+#define DASHBOARD_ETAG "\"da27a79e\""
+
+const unsigned char dashboardGz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0x6b, 0x77, 0xdb, 0x36,
+  0xb2, 0x9f, 0xe9, 0x5f, 0x81, 0xaa, 0xa7, 0xad, 0x94, 0xe8, 0x41, 0xf9, 0x95, 0xc4, 0xb2, 0xbc,
+  0xd7, 0xb5, 0x9d, 0xc4, 0x8d, 0x13, 0xe7, 0x58, 0x6e, 0x7c, 0x7b, 0x7a, 0x72, 0x72, 0x20, 0x12,
+  0x92, 0x58, 0x53, 0x04, 0x2f, 0x1f, 0x96, 0xb5, 0xdd, 0xec, 0x6f, 0xbf, 0x33, 0x03, 0x80, 0x04,
+  0x29, 0xc9, 0x4e, 0xd2, 0xdd, 0xbb, 0xd7, 0xa7, 0xb1, 0x64, 0x02, 0x33, 0x18, 0xcc, 0x7b, 0x80,
+  0x61, 0x0f, 0xbf, 0x3b, 0xbd, 0x3c, 0xb9, 0xfe, 0xed, 0xfd, 0x19, 0x9b, 0x65, 0xf3, 0xf0, 0x68,
+  0xeb, 0x10, 0x3f, 0x58, 0xc8, 0xa3, 0xe9, 0xb0, 0x21, 0xa2, 0x06, 0x3e, 0x10, 0xdc, 0x3f, 0xda,
+  0x62, 0xec, 0x70, 0x2e, 0x32, 0xce, 0xbc, 0x19, 0x4f, 0x52, 0x91, 0x0d, 0x1b, 0x79, 0x36, 0xe9,
+  0x3c, 0x6f, 0xb0, 0x5e, 0x39, 0x14, 0xf1, 0xb9, 0x18, 0x36, 0x12, 0x31, 0x11, 0x49, 0x22, 0x92,
+  0x06, 0xf3, 0x64, 0x94, 0x89, 0x08, 0xa6, 0x46, 0xb2, 0x53, 0x3e, 0x5d, 0x01, 0xe0, 0x79, 0x36,
+  0x93, 0xf6, 0xf4, 0xab, 0x00, 0x17, 0xf1, 0xd9, 0x45, 0x10, 0x79, 0x32, 0x8c, 0xd8, 0x2f, 0x79,
+  0xb8, 0x64, 0xdb, 0xee, 0xf6, 0xf6, 0x1a, 0x60, 0x5f, 0xa4, 0x5e, 0x12, 0xc4, 0x59, 0x20, 0x23,
+  0x0b, 0xc3, 0x2c, 0xcb, 0xe2, 0xf4, 0xa0, 0xd7, 0x9b, 0x06, 0xd9, 0x2c, 0x1f, 0x77, 0x3d, 0x39,
+  0xef, 0x69, 0xa4, 0x17, 0xfb, 0xbb, 0xbd, 0x91, 0x0c, 0x79, 0x41, 0x48, 0x16, 0x64, 0xa1, 0x38,
+  0xa2, 0x47, 0xec, 0x94, 0xa7, 0xb3, 0xb1, 0x84, 0x59, 0x87, 0x3d, 0xf5, 0x78, 0x6b, 0xeb, 0xf0,
+  0xbb, 0x4e, 0x67, 0x6b, 0xcb, 0x79, 0x9f, 0x48, 0x39, 0x61, 0xf0, 0x1f, 0x2c, 0xe1, 0x89, 0x38,
+  0x63, 0xbe, 0x99, 0xca, 0x32, 0xc9, 0xe2, 0x44, 0xa4, 0xb0, 0x2e, 0x3b, 0x4e, 0xfc, 0x3c, 0x88,
+  0x24, 0x9b, 0xf2, 0x6c, 0x26, 0x12, 0xe1, 0xb3, 0x30, 0xb8, 0x13, 0x6c, 0x74, 0x79, 0x71, 0x3e,
+  0x62, 0x41, 0x74, 0x27, 0x92, 0x4c, 0x24, 0x00, 0x99, 0x71, 0xc0, 0xf8, 0x61, 0xa7, 0xeb, 0x6e,
+  0x39, 0x27, 0x41, 0xe2, 0x85, 0x82, 0x8d, 0x79, 0x0a, 0xb3, 0xa7, 0x3c, 0x9f, 0x0a, 0x5c, 0x21,
+  0xcd, 0x92, 0xdc, 0xc3, 0x2d, 0xb1, 0xbb, 0xb4, 0x8b, 0xd8, 0xef, 0x02, 0x99, 0xa7, 0x8c, 0x27,
+  0x5e, 0xba, 0xe5, 0x8c, 0x82, 0x79, 0x1c, 0x06, 0x93, 0xc0, 0xe3, 0x34, 0xe3, 0x47, 0x96, 0x88,
+  0xb9, 0xbc, 0xe3, 0x21, 0x52, 0x27, 0xee, 0x61, 0x85, 0x08, 0xbe, 0xfb, 0x22, 0xf6, 0x45, 0xe4,
+  0x05, 0x22, 0x85, 0xa5, 0x4e, 0x61, 0x45, 0xe6, 0xcb, 0x45, 0x14, 0x4a, 0xee, 0xb3, 0x49, 0x22,
+  0xe7, 0x0c, 0xe8, 0x63, 0xa9, 0x48, 0xee, 0x90, 0x9e, 0x04, 0x88, 0x8c, 0x18, 0x4f, 0x97, 0x91,
+  0x37, 0x4b, 0x64, 0x04, 0x2b, 0x85, 0x4b, 0x58, 0xc6, 0x4b, 0x04, 0x3c, 0xce, 0x63, 0xa0, 0x57,
+  0xa4, 0x66, 0xd6, 0x78, 0xc9, 0xc6, 0x89, 0x5c, 0x00, 0x28, 0xe3, 0x51, 0x30, 0x57, 0x24, 0x1c,
+  0xbf, 0x3f, 0xdf, 0x42, 0x1e, 0xf1, 0x04, 0x44, 0x02, 0x04, 0x00, 0x91, 0xce, 0xdf, 0x14, 0xf6,
+  0x61, 0x2a, 0xc3, 0x20, 0xed, 0x86, 0xd2, 0x03, 0xa2, 0x3a, 0x32, 0xe9, 0x30, 0x33, 0xd0, 0x7f,
+  0xb1, 0xdd, 0xed, 0xef, 0x3f, 0xef, 0xf6, 0xbb, 0xfd, 0xdd, 0x1d, 0x00, 0x38, 0x15, 0x13, 0x9e,
+  0x87, 0x59, 0x8a, 0xfc, 0x34, 0xd4, 0x05, 0xd1, 0x94, 0xcd, 0x64, 0x9a, 0xb1, 0xc5, 0x0c, 0xd6,
+  0x26, 0x40, 0x8b, 0x7e, 0xcd, 0x6d, 0x5c, 0xfa, 0xd7, 0x14, 0x48, 0xe4, 0x91, 0x0f, 0xfb, 0xbe,
+  0x13, 0xa1, 0x8c, 0x53, 0xcd, 0x4b, 0x3f, 0xe1, 0x0b, 0x44, 0x12, 0xf8, 0x82, 0xa7, 0x0a, 0xb2,
+  0x79, 0x3d, 0xe3, 0xd1, 0x2d, 0x5b, 0xca, 0xbc, 0x75, 0x00, 0xcb, 0x1a, 0x4d, 0x59, 0x2c, 0x16,
+  0xdd, 0x49, 0x1e, 0x86, 0x69, 0xc6, 0xbd, 0xdb, 0x90, 0x8f, 0x53, 0x50, 0x9a, 0xde, 0x38, 0x94,
+  0xd3, 0x1e, 0xf0, 0x01, 0xb6, 0x19, 0x4d, 0x3b, 0x3c, 0xea, 0xa4, 0x77, 0xd3, 0x0e, 0x61, 0xee,
+  0x80, 0x4a, 0xc5, 0x32, 0x02, 0xa1, 0x77, 0x10, 0x6b, 0x07, 0x94, 0x90, 0x67, 0xde, 0xcc, 0x42,
+  0x68, 0xa9, 0x5e, 0xc4, 0x83, 0xdb, 0x3c, 0xed, 0x15, 0xc0, 0x48, 0xf1, 0x55, 0x57, 0x6b, 0xb7,
+  0xe3, 0x14, 0xea, 0xbd, 0xb5, 0xd5, 0xe9, 0x1c, 0xe1, 0xa0, 0x56, 0x3a, 0xe7, 0x64, 0x34, 0x82,
+  0x0f, 0x7c, 0xe8, 0x1c, 0xa6, 0xd9, 0x92, 0x14, 0xd2, 0x19, 0x4b, 0x7f, 0xc9, 0xfe, 0x84, 0xd1,
+  0x89, 0xc4, 0xd5, 0xf9, 0x3c, 0x08, 0x97, 0x07, 0x2c, 0xe5, 0x51, 0xda, 0x01, 0x0e, 0x05, 0x93,
+  0xc1, 0x96, 0xf3, 0x19, 0xa6, 0x75, 0xc7, 0x32, 0xf1, 0x41, 0x4c, 0x38, 0x53, 0x7d, 0x3d, 0xe8,
+  0xc7, 0xf7, 0x0c, 0xe5, 0xe1, 0xb3, 0x71, 0x08, 0xbb, 0x34, 0x13, 0xa7, 0xd7, 0xa8, 0xeb, 0x25,
+  0xca, 0x34, 0xf8, 0xbb, 0x38, 0x60, 0x7b, 0xee, 0x0f, 0x03, 0xf3, 0x64, 0x21, 0x82, 0xe9, 0x2c,
+  0x3b, 0x60, 0x91, 0x4c, 0xe6, 0x3c, 0xa4, 0xc7, 0x41, 0x18, 0x1e, 0x14, 0x68, 0x1c, 0x5f, 0xce,
+  0x83, 0x88, 0xc3, 0x4c, 0x54, 0xe4, 0x30, 0x88, 0x00, 0x1e, 0xb8, 0x3c, 0x05, 0xae, 0xe1, 0x68,
+  0x06, 0x6a, 0x09, 0xdc, 0xf3, 0xc0, 0xca, 0x0f, 0xd8, 0x3c, 0xf0, 0xfd, 0x50, 0x98, 0xb5, 0x6f,
+  0x6f, 0xea, 0xeb, 0xbe, 0xf8, 0x9a, 0x75, 0x79, 0x18, 0x4c, 0xa3, 0xb9, 0xa8, 0x2c, 0x5c, 0x2c,
+  0xb0, 0x8e, 0xaa, 0x72, 0xf0, 0x41, 0xa2, 0x66, 0x75, 0xaa, 0x76, 0xff, 0xf3, 0x54, 0x25, 0xb8,
+  0x2a, 0xd1, 0x55, 0x99, 0x24, 0x22, 0x5f, 0xcf, 0xf8, 0x9e, 0x94, 0x2b, 0xa5, 0x29, 0x8b, 0xc0,
+  0xcf, 0x66, 0x07, 0xac, 0xef, 0x2a, 0xba, 0xe7, 0x3c, 0x01, 0x61, 0x1c, 0x30, 0x70, 0xb5, 0x92,
+  0x68, 0x08, 0xd2, 0x38, 0xe4, 0xa0, 0x36, 0xd3, 0x24, 0x40, 0x70, 0x07, 0x3f, 0x3b, 0x99, 0x00,
+  0xcf, 0x02, 0xd6, 0x0e, 0xca, 0x1d, 0xe6, 0xf3, 0x28, 0x05, 0xf8, 0x49, 0x62, 0xfe, 0xa9, 0x45,
+  0x40, 0x11, 0x7b, 0x46, 0x13, 0x0f, 0x7b, 0x2a, 0x32, 0x6c, 0x15, 0x5e, 0xf2, 0x67, 0x50, 0x4d,
+  0xa5, 0xc4, 0x87, 0xa8, 0xa5, 0x47, 0x96, 0x2a, 0x8f, 0x3e, 0xbc, 0x62, 0xe9, 0x8c, 0xc7, 0x60,
+  0x93, 0x62, 0x12, 0x44, 0x01, 0x3a, 0x0e, 0xf4, 0x4d, 0xce, 0x69, 0x00, 0x9e, 0x61, 0x2a, 0x24,
+  0x78, 0x8e, 0x64, 0x89, 0x16, 0xe9, 0x38, 0xf7, 0xed, 0xa5, 0x43, 0x3f, 0x7b, 0x6e, 0x1b, 0xf4,
+  0x50, 0x7d, 0x77, 0xe2, 0xe0, 0x5e, 0x84, 0x04, 0xe2, 0x38, 0x57, 0xdc, 0x0f, 0xf2, 0xd4, 0x29,
+  0x7f, 0x98, 0xb3, 0xeb, 0x9a, 0x19, 0xf8, 0x37, 0xfa, 0xd5, 0x7c, 0x0e, 0x21, 0x07, 0x9c, 0xa0,
+  0x70, 0xb6, 0xd9, 0x93, 0xf7, 0x01, 0x7b, 0xb2, 0xeb, 0x32, 0xc7, 0x19, 0xb2, 0xed, 0xbd, 0x3e,
+  0xb3, 0xa6, 0xea, 0x1f, 0x3d, 0x67, 0xa7, 0xef, 0xe0, 0x9c, 0xfe, 0x8b, 0x3d, 0xb5, 0x12, 0x91,
+  0xe7, 0x01, 0xb6, 0xae, 0x5e, 0x88, 0xe1, 0xdc, 0xbe, 0x0b, 0xdb, 0x98, 0x82, 0x83, 0xac, 0xa2,
+  0x00, 0xc4, 0xbd, 0x9d, 0x7d, 0x97, 0x3d, 0x81, 0x09, 0x88, 0x64, 0x77, 0x7f, 0xcd, 0x42, 0x80,
+  0xba, 0x9c, 0xc5, 0x60, 0x56, 0x7f, 0x47, 0x2d, 0xe5, 0xf4, 0x7f, 0x40, 0x1f, 0xee, 0xc3, 0x8a,
+  0x4e, 0x7f, 0xf7, 0x19, 0xeb, 0x81, 0xf4, 0x14, 0x31, 0xdd, 0xdd, 0x7d, 0x3d, 0x05, 0x54, 0x82,
+  0xc5, 0x32, 0x88, 0x32, 0x47, 0x4d, 0xd9, 0x46, 0x72, 0x60, 0xca, 0xb3, 0x1d, 0x7b, 0xf7, 0x4e,
+  0x22, 0x33, 0x72, 0xcd, 0x40, 0xd3, 0x33, 0x97, 0x75, 0x70, 0xa1, 0xde, 0x36, 0xa1, 0xda, 0xdf,
+  0x73, 0x0c, 0xe5, 0x86, 0xf9, 0x18, 0x35, 0x13, 0x19, 0x12, 0x24, 0x44, 0x12, 0xa1, 0xdc, 0x2f,
+  0x3c, 0xba, 0x15, 0xf8, 0x48, 0x7d, 0xeb, 0x60, 0xc0, 0xe3, 0x49, 0xc2, 0x97, 0x8e, 0xdb, 0x81,
+  0x8d, 0x55, 0x67, 0x67, 0x81, 0x77, 0x4b, 0x8e, 0x5b, 0xc6, 0xf6, 0x7c, 0x39, 0x99, 0x40, 0xaa,
+  0xe0, 0x74, 0x9e, 0xed, 0xa8, 0xe9, 0x41, 0x92, 0xc8, 0x84, 0x85, 0x62, 0x92, 0xf5, 0x48, 0x9b,
+  0xe1, 0x59, 0x96, 0x80, 0xe3, 0x9a, 0x80, 0x25, 0x31, 0xfa, 0x86, 0xea, 0x07, 0x21, 0x2d, 0x85,
+  0x70, 0x21, 0x4a, 0xd7, 0x77, 0x37, 0x65, 0xa4, 0xd0, 0xc3, 0x86, 0xdb, 0x60, 0x33, 0x32, 0x3f,
+  0xfc, 0x0a, 0x63, 0xce, 0x21, 0xa8, 0x53, 0x8a, 0x5f, 0x9c, 0x43, 0x74, 0xf3, 0xc3, 0x06, 0x19,
+  0x41, 0x63, 0xcb, 0xa2, 0x5c, 0x83, 0x3e, 0x57, 0x0f, 0xd1, 0x56, 0x87, 0x0d, 0x5a, 0x2c, 0xe6,
+  0xa0, 0x1e, 0x99, 0x7a, 0x5c, 0xd0, 0x01, 0x09, 0x0c, 0x32, 0x4f, 0x34, 0x81, 0x55, 0xa8, 0x7d,
+  0xf8, 0xaf, 0x45, 0x4b, 0xc1, 0x12, 0x9e, 0x0a, 0xd7, 0x5e, 0xc8, 0xd3, 0x94, 0x90, 0x78, 0xb7,
+  0x0d, 0x2d, 0x5b, 0xef, 0x7e, 0xd8, 0xd8, 0x03, 0xf2, 0xbc, 0xa5, 0xfa, 0x4c, 0x86, 0x8d, 0x5d,
+  0xd7, 0x0c, 0x2a, 0x4a, 0x86, 0x8d, 0xc5, 0x2c, 0x80, 0x60, 0x3a, 0x87, 0xef, 0xd5, 0x11, 0x8b,
+  0x5b, 0xb8, 0xb1, 0xd5, 0x31, 0xe2, 0xfc, 0xb0, 0x01, 0x8c, 0x6f, 0xa3, 0xfe, 0x1a, 0x7a, 0x7a,
+  0x8a, 0xa0, 0xb5, 0xd4, 0x29, 0xe8, 0x87, 0xc9, 0xfb, 0x02, 0x34, 0x28, 0xda, 0xaf, 0xda, 0x23,
+  0xb9, 0xc1, 0xda, 0x16, 0xb4, 0x08, 0xfa, 0x0f, 0x6c, 0xad, 0xbb, 0xb7, 0x71, 0x67, 0x87, 0xbd,
+  0xe9, 0x11, 0xe9, 0xbf, 0x21, 0x0d, 0xe5, 0xdc, 0x77, 0xb7, 0xdd, 0x0e, 0x11, 0xb7, 0x86, 0xd2,
+  0x87, 0x08, 0x7d, 0x44, 0xd2, 0x6a, 0xd2, 0x06, 0x2d, 0x29, 0x36, 0xe9, 0xf3, 0xe4, 0x16, 0xac,
+  0x68, 0x59, 0x79, 0x5c, 0xd3, 0xb4, 0x75, 0xb2, 0x05, 0xd3, 0xe9, 0xee, 0xaf, 0x0e, 0x5b, 0x3c,
+  0xe8, 0xef, 0xb6, 0x59, 0x85, 0x17, 0x36, 0x2b, 0x0e, 0x7b, 0x5a, 0xdd, 0x0f, 0x31, 0x9b, 0xa8,
+  0xe4, 0x0a, 0xaf, 0x72, 0x0e, 0x09, 0x8f, 0xce, 0x44, 0xc9, 0xf8, 0xe1, 0xe1, 0x8f, 0xdf, 0x3f,
+  0xdf, 0xdd, 0xeb, 0x0f, 0x30, 0xbb, 0x22, 0x9b, 0x67, 0x27, 0x85, 0x51, 0xf9, 0xc1, 0x5d, 0x69,
+  0x2f, 0x69, 0x43, 0x33, 0x18, 0x9e, 0x6a, 0x01, 0xa0, 0xd1, 0xdd, 0x05, 0x62, 0x31, 0x96, 0xc0,
+  0x4b, 0x97, 0xb9, 0x18, 0x4b, 0xd8, 0xfe, 0x9e, 0x96, 0x8f, 0x73, 0x98, 0xa7, 0x4a, 0x0e, 0x29,
+  0x66, 0xce, 0xaf, 0xc0, 0x2c, 0x21, 0xc3, 0x1f, 0x36, 0xbe, 0xb7, 0xcc, 0xaf, 0xe4, 0xd6, 0x54,
+  0x86, 0xfe, 0x66, 0xc9, 0xbb, 0xb6, 0xe0, 0x61, 0x67, 0x80, 0xd9, 0x7c, 0xc7, 0x48, 0x67, 0xc4,
+  0xab, 0xd2, 0x94, 0x06, 0xd3, 0xa2, 0x05, 0xc0, 0xed, 0xfd, 0x86, 0x4a, 0xdc, 0x21, 0x5d, 0x87,
+  0x89, 0x15, 0xa0, 0x92, 0xb4, 0xeb, 0x42, 0x41, 0x6e, 0x6f, 0x6c, 0xe8, 0x5d, 0x80, 0xee, 0x76,
+  0xbb, 0x0f, 0xc3, 0x6e, 0x5b, 0xc0, 0x33, 0x1b, 0x7a, 0xef, 0xc5, 0x0a, 0xb4, 0x96, 0x09, 0x7d,
+  0x23, 0x3e, 0x7e, 0x23, 0x47, 0xc7, 0x3c, 0x83, 0x24, 0x7a, 0xf9, 0x08, 0x4f, 0x51, 0x03, 0x53,
+  0xc1, 0x51, 0xac, 0xd1, 0x03, 0xce, 0x04, 0x7c, 0xef, 0xa3, 0x9c, 0xd7, 0xe3, 0x96, 0x61, 0x7c,
+  0xa3, 0x30, 0x7e, 0x56, 0x94, 0x6f, 0x60, 0xa9, 0xd9, 0xd7, 0xb7, 0x09, 0xa4, 0x80, 0x3e, 0x8f,
+  0x6c, 0x99, 0x30, 0x0a, 0x24, 0x84, 0x66, 0x7f, 0x47, 0x49, 0x06, 0xd0, 0x3c, 0x86, 0xe3, 0x32,
+  0xcf, 0x1e, 0x46, 0x02, 0x1f, 0x47, 0xff, 0x0e, 0xd9, 0x62, 0x9e, 0xf5, 0x88, 0x60, 0x25, 0x88,
+  0x61, 0x8a, 0xd5, 0xe3, 0xff, 0x17, 0xa9, 0xbe, 0x02, 0x9a, 0x37, 0x30, 0x94, 0xb6, 0xf3, 0x6d,
+  0xf2, 0x54, 0xa0, 0x7f, 0x41, 0x98, 0x0a, 0xc1, 0x7f, 0x4c, 0x92, 0x33, 0xa8, 0x93, 0xc5, 0x23,
+  0xa2, 0xf4, 0x64, 0x12, 0x4d, 0x42, 0xb9, 0x10, 0xc9, 0x38, 0xcc, 0xc5, 0xff, 0x9d, 0xc4, 0x4e,
+  0xc5, 0x1c, 0x8a, 0xe1, 0x0d, 0x7c, 0x53, 0x84, 0x7f, 0x9b, 0xd0, 0x34, 0xec, 0x83, 0x5e, 0xf1,
+  0xaf, 0x33, 0x7b, 0x7f, 0x93, 0x4b, 0x1c, 0x5d, 0x9e, 0xfc, 0x35, 0xaf, 0xf8, 0x97, 0x23, 0xce,
+  0xf3, 0xc6, 0xd1, 0x09, 0x60, 0x81, 0x48, 0x1b, 0xe2, 0x49, 0xc3, 0xc3, 0x7e, 0x06, 0xc9, 0xfd,
+  0x4b, 0xce, 0x8e, 0x10, 0x6c, 0x66, 0xf6, 0xa3, 0x8e, 0x8e, 0xe0, 0x5f, 0x6f, 0x82, 0xaf, 0x5b,
+  0x86, 0x62, 0xb7, 0xe6, 0x6e, 0x99, 0x5e, 0x59, 0xec, 0x59, 0x15, 0xe7, 0x57, 0x1a, 0x4f, 0x41,
+  0x20, 0x96, 0x9a, 0x1b, 0xec, 0xf6, 0xc5, 0xb6, 0xda, 0xdd, 0xee, 0xc6, 0xdd, 0x65, 0xc1, 0x5c,
+  0x3c, 0x0c, 0xbc, 0xbf, 0xfd, 0xa8, 0x1e, 0x96, 0x3b, 0x28, 0x4a, 0x54, 0x3a, 0x48, 0x2c, 0xab,
+  0x0e, 0xfa, 0x93, 0x54, 0xb6, 0xd7, 0x73, 0xce, 0xcd, 0xf1, 0x5d, 0x22, 0xa6, 0x41, 0x8a, 0x5f,
+  0xb8, 0xef, 0x43, 0xb2, 0x95, 0x52, 0x09, 0xd8, 0xeb, 0xc1, 0x2f, 0x3a, 0xb8, 0xc3, 0xd3, 0xbe,
+  0xe3, 0xab, 0x4f, 0x57, 0x54, 0x97, 0x41, 0xc1, 0xb5, 0xb3, 0xe3, 0xee, 0x3d, 0x1b, 0x14, 0xa3,
+  0x3f, 0x1f, 0x5f, 0x5f, 0x9f, 0x9c, 0x7e, 0xba, 0x2a, 0x46, 0xfb, 0x3b, 0x7b, 0x03, 0xfa, 0xa3,
+  0xd7, 0x03, 0x76, 0x79, 0xa4, 0x5b, 0x90, 0x04, 0x42, 0x15, 0x98, 0xaa, 0x3f, 0x2a, 0xa0, 0x67,
+  0x57, 0xbf, 0xd9, 0xb0, 0xbb, 0x2f, 0x4a, 0xcc, 0xaf, 0xae, 0xce, 0x0d, 0x5e, 0x8d, 0xd8, 0x2d,
+  0x10, 0x3f, 0x85, 0x32, 0x4d, 0xdc, 0xc7, 0x32, 0xc9, 0xda, 0xac, 0x03, 0xdf, 0x83, 0x39, 0x7e,
+  0xaf, 0x60, 0x06, 0x55, 0xa9, 0x50, 0x65, 0x61, 0xbe, 0x3e, 0x7b, 0xfb, 0xde, 0xc6, 0xec, 0xbe,
+  0xd8, 0x19, 0x6c, 0x95, 0xeb, 0x9e, 0xbd, 0xfb, 0x74, 0x7d, 0x79, 0x7a, 0xac, 0x09, 0xa3, 0x09,
+  0xb0, 0xa7, 0xca, 0xf8, 0x6f, 0x67, 0xa3, 0x6b, 0x7b, 0x78, 0xdf, 0x82, 0x3f, 0x79, 0xfd, 0xca,
+  0xc0, 0x33, 0xb3, 0xfa, 0xfe, 0x4e, 0xc9, 0x93, 0x6e, 0x9f, 0x81, 0x88, 0x2b, 0xd3, 0x2d, 0x74,
+  0x0e, 0xce, 0xde, 0xb5, 0xd0, 0x9d, 0x9e, 0x8f, 0xea, 0xe4, 0xf4, 0xf7, 0x9f, 0x6d, 0x44, 0x87,
+  0xd3, 0xab, 0xd4, 0xf5, 0xf7, 0x9f, 0xdb, 0xbb, 0x43, 0xae, 0x9e, 0xc3, 0xfe, 0x0d, 0x4e, 0x9a,
+  0xf2, 0xac, 0x3f, 0x58, 0x9d, 0x61, 0xd0, 0xa8, 0x19, 0xdb, 0xb5, 0x19, 0x67, 0xff, 0x5d, 0xc7,
+  0xb1, 0xb7, 0x66, 0x46, 0x15, 0x87, 0xcd, 0xa6, 0xd7, 0x97, 0xbf, 0x8e, 0xce, 0x2a, 0xf2, 0xdd,
+  0xb5, 0xd4, 0x4a, 0x8d, 0x96, 0xfb, 0x56, 0xf0, 0x2f, 0x06, 0x5a, 0x79, 0x3f, 0x04, 0x49, 0x96,
+  0x43, 0xa5, 0x6f, 0x74, 0x37, 0x65, 0x50, 0x5f, 0x7b, 0x39, 0x16, 0xdb, 0x3e, 0x93, 0x91, 0x75,
+  0x1a, 0x5c, 0xd5, 0x65, 0xa3, 0x72, 0x6f, 0x6e, 0x5e, 0x17, 0x68, 0x41, 0x7c, 0x75, 0x6e, 0xb2,
+  0x40, 0xa1, 0xd0, 0x5e, 0x67, 0x05, 0xfc, 0xed, 0xf9, 0xbb, 0x91, 0xd9, 0xd5, 0x8e, 0xbb, 0x5b,
+  0x80, 0xcf, 0x83, 0x28, 0xc7, 0xb3, 0xe5, 0x4c, 0xb2, 0x6d, 0xf7, 0x07, 0xc6, 0x33, 0xc2, 0xe2,
+  0xe5, 0x09, 0x16, 0x5c, 0x0f, 0x58, 0xc0, 0x4d, 0x29, 0x2d, 0xb0, 0xae, 0x02, 0x5d, 0x1a, 0x4c,
+  0x23, 0xd8, 0x8f, 0xa6, 0x82, 0x2d, 0xe0, 0x33, 0x55, 0xfa, 0x6e, 0x50, 0x05, 0xd1, 0x54, 0x73,
+  0xe4, 0x8e, 0x27, 0x74, 0xa4, 0x4e, 0x88, 0x79, 0x94, 0xd5, 0x8c, 0xf8, 0xe5, 0xd9, 0xf5, 0xc9,
+  0xeb, 0x4f, 0xd7, 0xe7, 0x6f, 0xcf, 0x2e, 0x7f, 0xbd, 0x56, 0x6b, 0xed, 0xb9, 0xae, 0x5b, 0x32,
+  0x7c, 0x74, 0x76, 0xf5, 0xe1, 0xec, 0xea, 0xd3, 0xf9, 0x3b, 0x20, 0xe8, 0xc3, 0xf1, 0x05, 0xcd,
+  0xd8, 0xae, 0xcc, 0x78, 0x79, 0x75, 0xfc, 0xf6, 0xec, 0xd3, 0xc9, 0xeb, 0xb3, 0x93, 0x37, 0xfa,
+  0x8c, 0xa6, 0x5f, 0x19, 0x47, 0xe4, 0xa3, 0xeb, 0x63, 0x50, 0x9c, 0x02, 0x49, 0x7d, 0x8a, 0x42,
+  0x71, 0x79, 0x71, 0x6a, 0x9c, 0x49, 0x75, 0x85, 0xd3, 0xe3, 0xeb, 0xe3, 0x72, 0x74, 0x85, 0xc4,
+  0x37, 0x37, 0x9f, 0x4e, 0xcf, 0x4e, 0xce, 0xdf, 0x1e, 0x5f, 0x8c, 0x34, 0x01, 0xdb, 0xf6, 0xe0,
+  0xeb, 0x62, 0x54, 0x53, 0x67, 0xad, 0xfb, 0x7e, 0x54, 0x9c, 0x56, 0x01, 0x93, 0x4b, 0x3f, 0xb2,
+  0xe3, 0xb2, 0x49, 0x9c, 0xb2, 0x20, 0x65, 0x71, 0x08, 0x22, 0x5a, 0x6a, 0x66, 0x62, 0x44, 0xac,
+  0x31, 0xf0, 0xe2, 0xec, 0xe5, 0xf5, 0xa7, 0xe3, 0xab, 0xab, 0xcb, 0x1b, 0x8d, 0xa5, 0x01, 0xa5,
+  0xe8, 0xde, 0x8b, 0xed, 0x41, 0xa3, 0x5c, 0xe6, 0xea, 0xfc, 0xd5, 0xeb, 0x75, 0x93, 0x76, 0xed,
+  0x49, 0x88, 0xa8, 0x3a, 0xd1, 0x4c, 0xdb, 0xc7, 0x69, 0x8a, 0x80, 0x2b, 0xe3, 0x93, 0x13, 0xf1,
+  0x3f, 0xb9, 0x00, 0xa8, 0x0d, 0x62, 0x3d, 0x3e, 0x3d, 0xbd, 0x3a, 0x1b, 0x8d, 0xd8, 0x90, 0xfd,
+  0xae, 0xdd, 0xf4, 0xd3, 0xee, 0x76, 0xdb, 0x76, 0x61, 0x6d, 0xeb, 0xa4, 0xce, 0x52, 0xb7, 0x76,
+  0xd5, 0x14, 0xda, 0x35, 0xd5, 0x6e, 0x97, 0x2e, 0xb4, 0x6d, 0x3b, 0xb4, 0xb6, 0xed, 0x8e, 0x6c,
+  0xd4, 0xca, 0x59, 0xab, 0xc5, 0x6b, 0x1e, 0xa6, 0xbd, 0xe2, 0x2f, 0x6c, 0x40, 0xed, 0x06, 0xda,
+  0x55, 0x8b, 0xb7, 0x67, 0x28, 0x6f, 0xfd, 0x71, 0x50, 0xdf, 0xf4, 0xa7, 0x8b, 0xb3, 0x77, 0x90,
+  0x0c, 0xc0, 0xde, 0xf5, 0x83, 0x2e, 0x88, 0x70, 0x9a, 0xcd, 0x56, 0x27, 0x22, 0x7f, 0x1a, 0x7f,
+  0xd3, 0xe1, 0x6d, 0xd8, 0x60, 0x4f, 0x0b, 0x88, 0x3f, 0x64, 0x10, 0x35, 0x5b, 0x06, 0x42, 0x86,
+  0xa2, 0x1b, 0xca, 0x69, 0xb3, 0x80, 0x6b, 0x19, 0x79, 0xbc, 0x0a, 0xe5, 0x98, 0x87, 0x05, 0xf3,
+  0x43, 0x91, 0xb1, 0x48, 0x2c, 0x7e, 0x49, 0xc1, 0xd5, 0x0c, 0xd9, 0x9f, 0x9f, 0x07, 0xce, 0x9a,
+  0x1f, 0x50, 0x2f, 0xf4, 0x47, 0x69, 0x46, 0x17, 0x64, 0x20, 0xc9, 0x2c, 0x4f, 0xc8, 0x9c, 0x97,
+  0xe8, 0xac, 0xc2, 0x91, 0x71, 0x4f, 0x16, 0xb2, 0x6b, 0xc8, 0x03, 0x00, 0x21, 0xfc, 0xc5, 0x4e,
+  0xf1, 0x1c, 0xa7, 0xb5, 0x82, 0x11, 0x33, 0x85, 0x2f, 0xc0, 0x87, 0xc7, 0xe1, 0x0f, 0x52, 0x57,
+  0x23, 0x4e, 0x1f, 0x9f, 0x2b, 0x6c, 0xea, 0x86, 0xac, 0xb8, 0x3a, 0xdc, 0xd2, 0x38, 0x21, 0x3b,
+  0xc9, 0x5e, 0xe2, 0x85, 0x18, 0x20, 0x75, 0x37, 0xe0, 0x94, 0x51, 0xb8, 0x64, 0x02, 0x2f, 0xe1,
+  0x64, 0x24, 0xe8, 0x42, 0x8d, 0x4d, 0x08, 0xc4, 0xe8, 0x31, 0xb8, 0x44, 0x4e, 0x9b, 0xa8, 0x23,
+  0x5d, 0xd9, 0xfa, 0x60, 0xed, 0xd6, 0x6b, 0xb4, 0x11, 0x3c, 0x6d, 0x5f, 0xf8, 0x5b, 0x5a, 0x56,
+  0xa3, 0x8c, 0x43, 0x70, 0x88, 0x8d, 0xac, 0x82, 0x49, 0x73, 0x11, 0x44, 0xbe, 0x5c, 0x74, 0xcf,
+  0xee, 0xc0, 0xc4, 0x47, 0x32, 0x4f, 0x3c, 0xd1, 0xa2, 0x3b, 0x05, 0x27, 0x44, 0x23, 0x8b, 0x14,
+  0xe7, 0x9a, 0x2a, 0x5e, 0xfc, 0x7a, 0x75, 0xd1, 0x6c, 0xd5, 0x16, 0x27, 0x5f, 0xac, 0xee, 0x16,
+  0xe3, 0x3c, 0x9d, 0x01, 0x97, 0xe8, 0xca, 0xd3, 0x71, 0x3e, 0x33, 0x11, 0xa6, 0xea, 0xa2, 0xc9,
+  0x29, 0x65, 0xd0, 0xac, 0xf9, 0xd2, 0x36, 0x5b, 0x87, 0x1a, 0x70, 0xe2, 0x39, 0x35, 0x44, 0x0c,
+  0x74, 0xdb, 0xb1, 0x00, 0xf7, 0xed, 0x07, 0x5e, 0x21, 0xdb, 0x24, 0x10, 0x77, 0x1c, 0x8f, 0xb0,
+  0x3f, 0xc3, 0x3f, 0x28, 0x91, 0xcf, 0x23, 0x70, 0x07, 0xf0, 0xa4, 0xa9, 0x38, 0x80, 0xec, 0x6a,
+  0xaf, 0x71, 0xb9, 0x06, 0x3d, 0x60, 0x87, 0xd8, 0x98, 0xe3, 0x1d, 0x30, 0xf2, 0x0d, 0x7c, 0xc7,
+  0x3c, 0x36, 0x57, 0x9f, 0x86, 0x51, 0xef, 0xf1, 0xde, 0xdb, 0xbe, 0x38, 0x05, 0x02, 0x59, 0x6c,
+  0xee, 0x3c, 0x19, 0x14, 0x6c, 0xc4, 0xd9, 0x31, 0xf7, 0x6e, 0x95, 0xe6, 0x3b, 0x37, 0xeb, 0x6e,
+  0x2d, 0xb9, 0xbe, 0x23, 0xc6, 0xb9, 0x0c, 0x27, 0x9b, 0x0b, 0x4f, 0xba, 0xe8, 0xcc, 0x66, 0x20,
+  0x72, 0x0d, 0x82, 0x0f, 0x63, 0x4e, 0xf1, 0x0f, 0x90, 0x05, 0x5d, 0xd1, 0xa5, 0x47, 0xe7, 0xef,
+  0x4d, 0xea, 0xc9, 0x60, 0x49, 0xbc, 0x05, 0x57, 0xc1, 0xd7, 0x5c, 0xcb, 0x86, 0x89, 0xe0, 0xfe,
+  0x12, 0xf6, 0x03, 0x06, 0x0a, 0x68, 0x8c, 0x60, 0x27, 0x79, 0xa4, 0xae, 0x94, 0x2d, 0xee, 0x6a,
+  0x51, 0x90, 0xf5, 0x83, 0xc2, 0x41, 0xc1, 0x00, 0x8c, 0x8c, 0xa6, 0xa0, 0x58, 0x5a, 0x07, 0xf0,
+  0xde, 0x16, 0x81, 0xba, 0x50, 0x53, 0x25, 0x1e, 0xf9, 0x0a, 0x3d, 0x3d, 0x4f, 0x42, 0xba, 0xef,
+  0x4d, 0xb5, 0x16, 0x02, 0xbe, 0x11, 0xcd, 0x51, 0x4f, 0x9b, 0x16, 0x3a, 0x72, 0x18, 0xa4, 0xbe,
+  0x00, 0x04, 0xd3, 0x0b, 0xd0, 0xee, 0x54, 0x64, 0xcd, 0x9f, 0x14, 0x3d, 0x3f, 0xb5, 0xa8, 0x96,
+  0x00, 0xf5, 0xa3, 0x49, 0x80, 0x34, 0x0f, 0xc3, 0x96, 0x86, 0xa8, 0x53, 0x43, 0xac, 0xfa, 0xc7,
+  0x3f, 0x58, 0xc3, 0xba, 0x5d, 0x56, 0xc1, 0xa0, 0xe2, 0x98, 0x00, 0x58, 0xad, 0xad, 0x8c, 0x1f,
+  0x91, 0x0d, 0x48, 0x45, 0x14, 0x47, 0xdf, 0xf2, 0x5b, 0x90, 0x65, 0x9e, 0x10, 0xff, 0xe0, 0x37,
+  0x84, 0x35, 0x32, 0x48, 0x63, 0x8b, 0xea, 0x72, 0xbb, 0x6a, 0x90, 0x73, 0xee, 0x8b, 0x8a, 0x55,
+  0x02, 0x9e, 0xeb, 0x99, 0x00, 0xc5, 0x40, 0x71, 0xa6, 0x42, 0xcc, 0x51, 0x9c, 0xb0, 0x2f, 0x10,
+  0x67, 0x04, 0xb6, 0x03, 0x62, 0x14, 0x68, 0x47, 0x90, 0x7d, 0x01, 0x66, 0xbc, 0xa1, 0x46, 0x91,
+  0xe7, 0x31, 0x0b, 0x26, 0xda, 0x0e, 0xcb, 0xe4, 0xc9, 0xbb, 0x9d, 0x26, 0x32, 0x8f, 0x56, 0x25,
+  0xa6, 0x17, 0x3f, 0x06, 0x9a, 0xc8, 0xf8, 0x8d, 0xe0, 0xc0, 0x88, 0x22, 0x4f, 0x84, 0xc7, 0x86,
+  0x56, 0x35, 0x58, 0xf8, 0x08, 0xb5, 0x77, 0xc7, 0x76, 0x44, 0x16, 0x26, 0x0b, 0xa2, 0xe6, 0x25,
+  0x5a, 0x36, 0x93, 0x4e, 0x70, 0x5f, 0x96, 0xd2, 0xa3, 0x9a, 0x73, 0x65, 0x76, 0x0a, 0x8c, 0xfd,
+  0x48, 0x1b, 0x81, 0xac, 0x20, 0x4b, 0x45, 0x38, 0x61, 0xd8, 0x1f, 0x41, 0x00, 0xa4, 0x01, 0x0c,
+  0xef, 0xc9, 0x41, 0xf4, 0xc2, 0x36, 0x89, 0x73, 0x62, 0x10, 0x6a, 0x0d, 0xe1, 0xb9, 0xc5, 0xcb,
+  0x23, 0x39, 0x99, 0x10, 0x54, 0xd1, 0x57, 0xd1, 0x66, 0x50, 0xde, 0xe5, 0x73, 0xba, 0xbd, 0xcf,
+  0x52, 0x96, 0x66, 0x32, 0x8e, 0x81, 0x5b, 0x5a, 0x30, 0xf0, 0x94, 0xcc, 0xc3, 0xb4, 0x46, 0x28,
+  0x5a, 0x74, 0xb6, 0x0b, 0xb9, 0x1d, 0x1f, 0x87, 0x58, 0xa2, 0x63, 0x80, 0x53, 0x9d, 0x0d, 0x68,
+  0x0f, 0x31, 0xe8, 0x06, 0xde, 0x3f, 0xc6, 0x22, 0xf2, 0x55, 0x6b, 0xc1, 0x82, 0x85, 0x52, 0xa3,
+  0x9a, 0x88, 0xcc, 0x9b, 0xb1, 0x0c, 0x74, 0x22, 0x5d, 0x11, 0x80, 0xe5, 0xac, 0x26, 0xc0, 0xc2,
+  0x36, 0x6a, 0x12, 0xca, 0x60, 0xcb, 0x51, 0xb5, 0xa1, 0x22, 0x9d, 0x9c, 0x6b, 0xd9, 0x17, 0xa2,
+  0x14, 0x67, 0xc1, 0x53, 0xe0, 0xd7, 0x62, 0x16, 0x00, 0x3d, 0x7c, 0x2a, 0x59, 0x87, 0x76, 0x13,
+  0x27, 0x10, 0x20, 0xc7, 0xa0, 0x11, 0xd9, 0x2c, 0x91, 0x59, 0x16, 0xaa, 0x48, 0x62, 0x99, 0xb1,
+  0xc6, 0x7c, 0x23, 0x7e, 0x4a, 0x44, 0x39, 0x7b, 0x9d, 0xaa, 0x28, 0x1f, 0x2e, 0x63, 0xe6, 0x4b,
+  0xc3, 0x15, 0x2d, 0x2a, 0x9a, 0xc1, 0xc0, 0x04, 0xc1, 0x95, 0x81, 0xe7, 0x0c, 0x2b, 0x6e, 0x62,
+  0x11, 0xa0, 0xbe, 0x22, 0x07, 0x88, 0x4e, 0x20, 0x72, 0xca, 0x83, 0x48, 0xe1, 0xd3, 0x86, 0x68,
+  0x82, 0x0b, 0xd0, 0x5c, 0x8d, 0x3b, 0x47, 0x65, 0x66, 0x5a, 0x68, 0xa2, 0x65, 0x76, 0x0d, 0xf0,
+  0x6e, 0x0a, 0x69, 0x43, 0xab, 0xe0, 0xaa, 0x02, 0x0f, 0xd6, 0x85, 0x43, 0x30, 0x1f, 0xb4, 0x8b,
+  0x05, 0xd4, 0x00, 0x3c, 0x22, 0x1d, 0x81, 0x8f, 0x32, 0x2a, 0x6e, 0xd1, 0xdd, 0x2b, 0x38, 0x77,
+  0x24, 0x42, 0xe6, 0x59, 0xb3, 0x14, 0x4b, 0xdb, 0x4e, 0xb7, 0xdb, 0xac, 0x14, 0xd2, 0x40, 0x61,
+  0xbe, 0x15, 0x22, 0x86, 0xe2, 0x5a, 0x78, 0xb7, 0xc8, 0xa3, 0xb9, 0x04, 0xa6, 0x4e, 0x88, 0xa8,
+  0x28, 0xc3, 0x5e, 0x97, 0xc2, 0x45, 0x10, 0xb9, 0x9f, 0x8d, 0x5c, 0x4f, 0xb4, 0x3b, 0xb7, 0x5b,
+  0x52, 0xb4, 0x09, 0x14, 0xca, 0xdb, 0xa9, 0x34, 0xce, 0xc0, 0x34, 0xf0, 0x22, 0xa5, 0xde, 0xc8,
+  0x3c, 0xf4, 0x75, 0xea, 0xc1, 0x26, 0x41, 0x92, 0x66, 0x25, 0x83, 0x95, 0x1b, 0xd5, 0x77, 0xaf,
+  0x21, 0xa0, 0x55, 0x7e, 0xf4, 0x78, 0x0c, 0x95, 0xf9, 0x49, 0xf1, 0xb4, 0xc8, 0x69, 0x60, 0x13,
+  0x0b, 0xec, 0x30, 0xf1, 0xe5, 0x94, 0x08, 0x98, 0xf3, 0x7b, 0xa3, 0xb2, 0xca, 0x11, 0x69, 0x84,
+  0xf4, 0x4c, 0x33, 0x08, 0x50, 0x5a, 0xdc, 0x02, 0xaf, 0x31, 0x3c, 0xb2, 0x16, 0xec, 0x72, 0x5c,
+  0xaa, 0xd9, 0x6a, 0x57, 0xab, 0x1d, 0xe5, 0x87, 0x09, 0x4d, 0x93, 0xfa, 0xa8, 0x0e, 0x7a, 0x3d,
+  0xcc, 0x01, 0xd1, 0x13, 0x3f, 0x65, 0x8d, 0xde, 0x95, 0x95, 0x10, 0x7e, 0x1a, 0xb5, 0xd9, 0x9f,
+  0x54, 0x77, 0xf1, 0xf0, 0xc0, 0x46, 0xad, 0x1e, 0xb1, 0xcf, 0x0a, 0x99, 0xd3, 0x05, 0xee, 0x45,
+  0xcd, 0xc2, 0x02, 0x81, 0x0c, 0xf3, 0xbd, 0xfb, 0x07, 0xa4, 0x5d, 0x10, 0xe6, 0x6d, 0x35, 0xc0,
+  0xae, 0x02, 0xb0, 0x00, 0x0b, 0xf2, 0x0f, 0xca, 0xcd, 0x8e, 0x90, 0x41, 0xd8, 0xcb, 0x44, 0x7f,
+  0xb7, 0x5a, 0x35, 0xed, 0x19, 0x53, 0xf3, 0x01, 0x01, 0x79, 0xc8, 0xa9, 0xa6, 0x48, 0x12, 0xbd,
+  0x63, 0x52, 0x4d, 0x81, 0x97, 0xcf, 0xf8, 0xb0, 0x65, 0xa8, 0x9a, 0x04, 0x11, 0xba, 0x65, 0xcd,
+  0x99, 0x3f, 0xcd, 0x25, 0x67, 0x08, 0x71, 0xcc, 0x30, 0xcd, 0x66, 0x67, 0x45, 0x69, 0x31, 0x1f,
+  0xc1, 0x89, 0xa4, 0x18, 0x46, 0x32, 0xe6, 0xc0, 0x71, 0xbd, 0x8a, 0x2a, 0xad, 0xac, 0xea, 0x26,
+  0xe1, 0x41, 0x17, 0x3b, 0x5f, 0x92, 0xf7, 0xc4, 0x2c, 0x33, 0x51, 0x68, 0x3e, 0x57, 0xfc, 0xf0,
+  0x05, 0xe5, 0x5e, 0x24, 0xfa, 0x6a, 0x6e, 0x65, 0x1a, 0xb4, 0x02, 0x90, 0x3e, 0x30, 0x0e, 0x3b,
+  0x08, 0x62, 0x10, 0x02, 0x96, 0xba, 0x26, 0x3a, 0x19, 0x88, 0x14, 0xfc, 0x5e, 0xaa, 0x34, 0x19,
+  0x5d, 0xd3, 0x2f, 0xa3, 0xcb, 0x77, 0xa0, 0xbd, 0xac, 0x77, 0x45, 0xfd, 0x55, 0x94, 0x87, 0x72,
+  0x06, 0x49, 0x53, 0x2e, 0xf0, 0x20, 0x2a, 0x9a, 0x0a, 0x28, 0x9f, 0x31, 0x64, 0xa1, 0x15, 0x52,
+  0x27, 0x1b, 0x85, 0x32, 0x4a, 0x58, 0x97, 0xa0, 0x68, 0x0b, 0x40, 0x08, 0xcc, 0xf5, 0xb5, 0x6b,
+  0xb7, 0xf2, 0x45, 0x10, 0x2f, 0x0c, 0x44, 0xc2, 0x03, 0x57, 0x07, 0x7e, 0x4d, 0x47, 0x86, 0x40,
+  0xb9, 0x49, 0x3d, 0x82, 0xf6, 0xe1, 0x27, 0x32, 0x4e, 0x4d, 0x09, 0x37, 0xc9, 0x53, 0x01, 0x5e,
+  0x5f, 0x74, 0xa7, 0x5d, 0xa8, 0x64, 0x77, 0xc0, 0x43, 0x81, 0xef, 0x56, 0x6b, 0xa9, 0x75, 0xd3,
+  0x0c, 0x32, 0x9b, 0x39, 0x3a, 0x41, 0x98, 0xd9, 0x06, 0xac, 0x20, 0x01, 0x89, 0x8d, 0x5f, 0xc8,
+  0x94, 0xa9, 0x94, 0x3e, 0x18, 0x23, 0x6e, 0x1d, 0x37, 0xa4, 0xb9, 0xb1, 0xe2, 0xc9, 0x2b, 0x29,
+  0xac, 0xf6, 0xe2, 0x85, 0xed, 0xd0, 0x32, 0x26, 0xa1, 0xb1, 0xb6, 0xb3, 0xd6, 0x0e, 0xd4, 0xe4,
+  0x8a, 0x31, 0xa8, 0xfa, 0xc7, 0x51, 0x23, 0x5d, 0x19, 0x81, 0x07, 0x4c, 0xf1, 0x52, 0x76, 0xc8,
+  0x9a, 0x6a, 0x07, 0x96, 0x0a, 0x23, 0xf3, 0xbb, 0x31, 0xa6, 0x94, 0x6a, 0xac, 0x8b, 0xde, 0xa4,
+  0xd5, 0x52, 0x0e, 0x53, 0x63, 0x80, 0x34, 0x8f, 0xa8, 0x50, 0xb2, 0x07, 0x82, 0x1b, 0x24, 0x86,
+  0x46, 0x9b, 0x29, 0x8d, 0xad, 0x96, 0x41, 0xe8, 0xaa, 0xbb, 0x91, 0x5c, 0x34, 0xab, 0x48, 0x20,
+  0x9b, 0xa1, 0xae, 0x0b, 0x24, 0x42, 0x19, 0x44, 0xd5, 0x63, 0x97, 0x66, 0xa1, 0x7c, 0x35, 0x38,
+  0x7e, 0x0d, 0x49, 0x79, 0xe4, 0x08, 0x6f, 0xc8, 0x21, 0x1f, 0x1b, 0xda, 0x0c, 0xe9, 0x9e, 0x5c,
+  0x5c, 0x8e, 0xce, 0x0a, 0xe7, 0x5f, 0xf5, 0xfe, 0x9a, 0x8b, 0x89, 0x11, 0xa8, 0xd6, 0x46, 0x13,
+  0x0b, 0x1e, 0xcc, 0xfc, 0x0b, 0xb3, 0xf8, 0x9a, 0x94, 0x5f, 0x25, 0xfd, 0x35, 0x7b, 0x79, 0x67,
+  0x1c, 0x74, 0xad, 0xdd, 0x51, 0x8d, 0xbe, 0xf9, 0xd7, 0xa6, 0x1c, 0xb6, 0x86, 0x55, 0x7c, 0x94,
+  0x62, 0x10, 0xe8, 0x67, 0x13, 0xd3, 0xdf, 0x80, 0x4a, 0x41, 0xf8, 0x38, 0xac, 0x15, 0xe5, 0xf0,
+  0xec, 0xe9, 0x53, 0x98, 0x5c, 0xd9, 0x38, 0x9e, 0x37, 0x43, 0xfe, 0x9f, 0x62, 0x67, 0xa8, 0x32,
+  0x4a, 0xca, 0x4e, 0x21, 0x16, 0x61, 0xce, 0xdf, 0x53, 0x8f, 0x62, 0x1e, 0x24, 0xaa, 0xe7, 0x47,
+  0x2b, 0xc3, 0xef, 0x1a, 0xf3, 0xef, 0xc1, 0xc7, 0x6e, 0x26, 0x5f, 0x06, 0xf7, 0xc2, 0x6f, 0xba,
+  0xad, 0x8f, 0xb0, 0x32, 0x12, 0xf4, 0x7b, 0x03, 0x79, 0xd2, 0xf8, 0x08, 0xa3, 0x2a, 0xd4, 0xd1,
+  0xef, 0x4d, 0x7a, 0x44, 0x83, 0xdc, 0xff, 0x23, 0x4f, 0xb3, 0x77, 0x6a, 0x8a, 0x7e, 0x66, 0xcb,
+  0x5b, 0x03, 0x6b, 0xdd, 0xff, 0x92, 0x48, 0x8f, 0xfb, 0xfb, 0x55, 0xe5, 0x8e, 0x15, 0xf6, 0x2b,
+  0x8b, 0x47, 0xdb, 0xa3, 0xbd, 0xa5, 0x96, 0x34, 0x8f, 0x89, 0x08, 0xb0, 0xea, 0x31, 0xe5, 0x34,
+  0xd5, 0x5e, 0x5a, 0xe5, 0x1f, 0xa9, 0xc3, 0x54, 0xbb, 0x2d, 0x62, 0x92, 0x3e, 0x70, 0xe8, 0x40,
+  0x22, 0x01, 0x26, 0x40, 0xf9, 0x37, 0x9e, 0x83, 0x0f, 0xf5, 0xdf, 0x28, 0x2c, 0x75, 0x3a, 0x38,
+  0xa4, 0x10, 0x91, 0xcf, 0x63, 0xdd, 0x34, 0x01, 0xd8, 0xf4, 0x45, 0x36, 0x85, 0xb6, 0x36, 0x1d,
+  0x71, 0xa2, 0x1f, 0xa4, 0x92, 0x3a, 0x11, 0x73, 0x48, 0x94, 0x50, 0x1b, 0x38, 0x64, 0x11, 0x77,
+  0x0f, 0x9d, 0xac, 0xea, 0x94, 0xae, 0x7a, 0xb2, 0x5a, 0x28, 0x4a, 0x8d, 0xb1, 0x3a, 0x9d, 0x54,
+  0xf9, 0x1c, 0xba, 0x67, 0xea, 0x81, 0x42, 0xff, 0x2c, 0xb1, 0x3c, 0xd1, 0x3c, 0x01, 0x8a, 0x54,
+  0xf7, 0xaf, 0x50, 0x8e, 0x5c, 0x6d, 0x18, 0x72, 0xda, 0x4c, 0xb9, 0x54, 0x83, 0x42, 0x7d, 0x1a,
+  0x9d, 0x28, 0x4e, 0xa7, 0x3e, 0xb2, 0x27, 0x78, 0xc8, 0x38, 0xa8, 0x0e, 0xeb, 0x23, 0xa3, 0x72,
+  0xec, 0xb3, 0xa9, 0x79, 0xd7, 0x89, 0x49, 0x8d, 0x5c, 0x62, 0x9a, 0x8f, 0x65, 0xac, 0x22, 0x00,
+  0xb2, 0x1e, 0x45, 0x03, 0x5a, 0xfc, 0x82, 0xa3, 0xf9, 0x54, 0xce, 0x95, 0xcb, 0xf4, 0x7b, 0x2c,
+  0x26, 0x98, 0x7e, 0xa5, 0x78, 0xec, 0x40, 0x5c, 0xd4, 0x79, 0xa7, 0xce, 0xb7, 0x56, 0x32, 0xe1,
+  0x6a, 0x9f, 0x31, 0x4b, 0x25, 0xae, 0x3a, 0x41, 0xbd, 0x36, 0x29, 0x9c, 0xb7, 0x5c, 0xe1, 0x6d,
+  0xad, 0xa2, 0xb1, 0x2b, 0xdd, 0xc2, 0x4f, 0x55, 0x52, 0xd4, 0x4d, 0x07, 0x2b, 0x83, 0x55, 0xd5,
+  0x55, 0xfb, 0x2c, 0xc8, 0x4b, 0x43, 0x49, 0x2d, 0xc6, 0x69, 0xa5, 0x5f, 0xda, 0xa4, 0x90, 0x6f,
+  0xa5, 0x3a, 0x7e, 0x56, 0xc7, 0x4b, 0x99, 0x5c, 0x00, 0x35, 0x69, 0xa1, 0x9b, 0x41, 0x04, 0x40,
+  0xd8, 0x28, 0x4a, 0xda, 0x89, 0x61, 0x4c, 0x70, 0xc8, 0xe8, 0x8a, 0x2b, 0x26, 0x92, 0xb9, 0x29,
+  0x32, 0xa6, 0x11, 0xf2, 0xcd, 0xd4, 0x53, 0x78, 0x70, 0x04, 0x1a, 0xbb, 0x6c, 0x53, 0xe1, 0xf9,
+  0x77, 0x91, 0xc8, 0x36, 0x59, 0x03, 0xe4, 0x1e, 0xa9, 0x86, 0x78, 0x83, 0x49, 0x2f, 0xa7, 0x58,
+  0x9c, 0x50, 0x5e, 0xc0, 0xa3, 0x25, 0xe4, 0xa7, 0x40, 0xab, 0xa7, 0x9b, 0x73, 0x91, 0x9b, 0x90,
+  0x6d, 0xdf, 0x82, 0xb5, 0xab, 0x16, 0x6b, 0xb0, 0x1b, 0xf4, 0x7a, 0xa0, 0x75, 0x94, 0x28, 0x53,
+  0xb1, 0x57, 0xad, 0x84, 0x0d, 0xf2, 0x93, 0xd1, 0x48, 0x75, 0xec, 0x51, 0x27, 0x27, 0xca, 0x3f,
+  0x92, 0x19, 0x06, 0x66, 0x90, 0x9f, 0xf0, 0x38, 0xde, 0x24, 0x4a, 0xe5, 0x5e, 0x55, 0xd7, 0x9f,
+  0x69, 0x6f, 0x57, 0x6d, 0xda, 0x53, 0x5d, 0xab, 0x40, 0x89, 0x32, 0x9d, 0x31, 0xb7, 0xcc, 0x8a,
+  0xd1, 0x4d, 0xd2, 0xbe, 0x36, 0x9d, 0x9a, 0x69, 0x21, 0xc4, 0x12, 0x16, 0xd6, 0x33, 0xf5, 0xb6,
+  0x0d, 0xb8, 0xf1, 0x01, 0xc3, 0x82, 0xef, 0x85, 0x4f, 0x74, 0x4b, 0x9f, 0x88, 0x2e, 0x71, 0x08,
+  0x75, 0x11, 0x75, 0xa3, 0x0a, 0x7f, 0x50, 0x22, 0x85, 0x7d, 0x10, 0x93, 0xa8, 0x42, 0x52, 0xc8,
+  0x20, 0x2b, 0xb9, 0xa7, 0xae, 0x7f, 0xca, 0xe1, 0x95, 0x1f, 0xd0, 0xc4, 0x1b, 0xff, 0xae, 0x32,
+  0x08, 0x90, 0x1c, 0xe6, 0x27, 0xc6, 0x27, 0xea, 0xf8, 0x88, 0x54, 0x65, 0x78, 0x93, 0x91, 0x7d,
+  0x50, 0xaa, 0x45, 0x44, 0xc1, 0xdc, 0x8f, 0x83, 0x62, 0x5c, 0x86, 0xfe, 0x07, 0x9b, 0x64, 0x1c,
+  0xc5, 0x23, 0x0e, 0x0d, 0x67, 0x07, 0xc5, 0x55, 0x22, 0xa8, 0x6c, 0x55, 0x8d, 0x98, 0x34, 0xbd,
+  0x54, 0x1c, 0x9d, 0xd9, 0xf0, 0x30, 0x9e, 0x71, 0x40, 0xdf, 0x7d, 0xce, 0x7a, 0xf6, 0xe9, 0x7e,
+  0x89, 0x14, 0xaf, 0x07, 0xb1, 0x9d, 0x1d, 0x1b, 0x42, 0x8d, 0x9a, 0x22, 0xc2, 0xc2, 0x1d, 0xb3,
+  0xff, 0x62, 0xff, 0xdc, 0x77, 0x27, 0x71, 0x5a, 0x90, 0x0c, 0x43, 0x48, 0x72, 0x53, 0x21, 0x7f,
+  0x62, 0x48, 0x6d, 0x41, 0x4a, 0xd4, 0x6c, 0xf6, 0x3b, 0x6a, 0xd1, 0x16, 0x0c, 0xe0, 0xde, 0x74,
+  0xf4, 0xaf, 0xee, 0x8f, 0x98, 0xf1, 0x41, 0x45, 0x0e, 0x47, 0x09, 0xf3, 0xe9, 0x70, 0x65, 0xcb,
+  0xeb, 0xac, 0x8f, 0xb4, 0x15, 0x35, 0x5f, 0x9a, 0x18, 0x4e, 0x3a, 0x80, 0x7a, 0xe8, 0x9a, 0x34,
+  0xe6, 0x2d, 0xcf, 0x66, 0x50, 0xe4, 0xa4, 0x4d, 0xc3, 0xfb, 0x0e, 0x2d, 0xd7, 0x82, 0xfa, 0x75,
+  0xaf, 0x65, 0xa9, 0x49, 0x96, 0xe4, 0x68, 0xe7, 0x80, 0x9c, 0xfb, 0x73, 0x50, 0x80, 0x14, 0x7b,
+  0x91, 0x67, 0xaa, 0x50, 0xc4, 0x73, 0x38, 0x0c, 0x02, 0xf4, 0xbe, 0x85, 0x29, 0x16, 0x3f, 0xeb,
+  0x02, 0xf9, 0x3b, 0x45, 0x32, 0x48, 0xe9, 0x3b, 0x8d, 0xad, 0xa5, 0x8b, 0xbd, 0x41, 0x8d, 0x6a,
+  0x70, 0x59, 0x94, 0x8c, 0x60, 0xe5, 0x28, 0x2d, 0x1b, 0x04, 0xec, 0x1d, 0xea, 0xf9, 0x77, 0xea,
+  0xee, 0x56, 0x1b, 0x0b, 0x65, 0x2f, 0x85, 0xff, 0xa0, 0xec, 0x7f, 0x2e, 0x01, 0x83, 0x65, 0x7b,
+  0xa5, 0xf1, 0x00, 0x03, 0x3e, 0xa0, 0xa8, 0x9a, 0xa6, 0x29, 0xaf, 0x8d, 0x05, 0xb3, 0xdb, 0x76,
+  0x1c, 0xb6, 0xeb, 0xba, 0x6e, 0xbb, 0xd4, 0x2e, 0x7d, 0xfb, 0xf1, 0x11, 0x86, 0x6e, 0x6f, 0x9a,
+  0x2b, 0x8f, 0x75, 0x06, 0x59, 0xe2, 0x2b, 0x5a, 0xd2, 0x00, 0xa0, 0xb3, 0xb3, 0x8f, 0xb8, 0xd4,
+  0xef, 0x02, 0xd4, 0xba, 0x2c, 0x01, 0xac, 0x61, 0x72, 0x0c, 0x46, 0xbf, 0x68, 0xae, 0x1d, 0x46,
+  0x05, 0x81, 0x55, 0x0b, 0xf1, 0xac, 0x9f, 0xb4, 0x42, 0x83, 0x6a, 0x9d, 0xa2, 0x2d, 0x75, 0xf0,
+  0x9e, 0xcc, 0x6d, 0xd7, 0x36, 0xa5, 0x2e, 0x55, 0x70, 0x4f, 0x2b, 0xcb, 0xeb, 0xa1, 0x8d, 0x2b,
+  0x9b, 0xf1, 0x95, 0x45, 0x75, 0x97, 0x4f, 0xc1, 0x48, 0xb5, 0x70, 0xb9, 0xa6, 0xbe, 0x8f, 0xa9,
+  0x33, 0xd2, 0x3c, 0xde, 0xc4, 0x48, 0x6a, 0x64, 0x69, 0x2b, 0xd1, 0xf4, 0xdd, 0x15, 0x46, 0xaa,
+  0x58, 0xdd, 0x76, 0x9a, 0x6b, 0x9e, 0xf6, 0xfa, 0x6e, 0xcb, 0xca, 0xec, 0xb0, 0x16, 0xf9, 0xa1,
+  0xa1, 0xb3, 0xaf, 0x52, 0x85, 0x48, 0x6f, 0x4c, 0x98, 0x41, 0xb5, 0xf1, 0x83, 0x04, 0xed, 0x46,
+  0x9f, 0x64, 0xd4, 0xdd, 0x84, 0xd2, 0x1f, 0x5f, 0x7a, 0x39, 0x46, 0x23, 0x3c, 0x97, 0x3d, 0x0b,
+  0x29, 0x30, 0xfd, 0xbc, 0x3c, 0xf7, 0x9b, 0x65, 0x33, 0x64, 0xab, 0x1b, 0x40, 0xf1, 0x96, 0xbc,
+  0xbe, 0x7e, 0x7b, 0x01, 0x86, 0xe3, 0xe0, 0xa6, 0x67, 0x26, 0x03, 0xfc, 0xdd, 0xba, 0x46, 0xfb,
+  0xa8, 0xf6, 0xbd, 0x11, 0xa1, 0xdd, 0xcc, 0x57, 0xc1, 0xe9, 0x38, 0xe5, 0xcd, 0x21, 0x09, 0xab,
+  0x44, 0x6f, 0x5d, 0xa5, 0x7d, 0x31, 0x7a, 0xec, 0x0e, 0xab, 0xe1, 0xb7, 0x2e, 0x13, 0x6b, 0x0b,
+  0x58, 0x17, 0x77, 0x5f, 0xb8, 0x80, 0xee, 0xcf, 0xa9, 0xae, 0x60, 0xa3, 0xac, 0xdc, 0x1a, 0x7e,
+  0x0d, 0xd2, 0xd7, 0x35, 0xa4, 0xa0, 0x87, 0x49, 0xba, 0x82, 0x56, 0xdd, 0x3e, 0x7e, 0x64, 0xbd,
+  0x7d, 0xf7, 0x11, 0xdc, 0x45, 0xb7, 0xdd, 0x8a, 0x04, 0x37, 0xf2, 0xbb, 0x7e, 0x31, 0xf9, 0xf1,
+  0x8b, 0x96, 0x58, 0xe1, 0x38, 0xae, 0xb1, 0x99, 0xe7, 0xf5, 0xbb, 0xce, 0xc7, 0x16, 0x29, 0x1a,
+  0xd0, 0x1e, 0xd4, 0xc4, 0xca, 0xe5, 0xe8, 0x63, 0x28, 0xa9, 0x15, 0x69, 0x05, 0x9d, 0xe3, 0x34,
+  0x8a, 0x96, 0x1f, 0x9c, 0xd1, 0x65, 0x0d, 0x08, 0x6b, 0xb5, 0x8c, 0x19, 0xdf, 0xd0, 0x40, 0xf7,
+  0x6f, 0x59, 0x64, 0x9f, 0x2c, 0x52, 0xf7, 0x5d, 0x37, 0x0a, 0xb3, 0xbc, 0x32, 0xf7, 0x07, 0x98,
+  0xc3, 0xd5, 0x53, 0x2a, 0x0c, 0xad, 0x11, 0xd3, 0xa1, 0xb5, 0x70, 0xe5, 0xe6, 0x08, 0xa9, 0x5e,
+  0x52, 0xb5, 0xc9, 0x63, 0x50, 0x1c, 0x6f, 0xb3, 0x0d, 0x47, 0xf7, 0x2b, 0xd9, 0x3b, 0x65, 0x0b,
+  0xea, 0x30, 0x45, 0x1d, 0xda, 0xe8, 0xe3, 0x78, 0x9e, 0x44, 0xe6, 0x5c, 0x86, 0x02, 0x14, 0xc4,
+  0x4f, 0xe0, 0x0f, 0x25, 0xe6, 0x10, 0xb5, 0x37, 0xe4, 0xd5, 0x48, 0x99, 0x49, 0xa9, 0x29, 0x11,
+  0x80, 0xf4, 0xb1, 0x72, 0x17, 0x69, 0x0e, 0x90, 0xe1, 0x79, 0xa7, 0x72, 0x4a, 0x71, 0x54, 0x34,
+  0x2d, 0x98, 0xdc, 0x68, 0xb3, 0x58, 0xb0, 0xc9, 0x0b, 0xf8, 0x2a, 0xee, 0xe9, 0x38, 0x94, 0x8e,
+  0x4f, 0x58, 0xe3, 0x06, 0x4a, 0x0b, 0x93, 0x99, 0x52, 0x29, 0x3b, 0x58, 0x7f, 0x7a, 0xfb, 0x95,
+  0x68, 0x15, 0xa7, 0x7c, 0xbc, 0xd9, 0xc1, 0x13, 0x1d, 0x20, 0x1c, 0x04, 0x4a, 0x25, 0x25, 0x6d,
+  0x56, 0xdd, 0x63, 0x35, 0x2b, 0x07, 0x0c, 0x57, 0xb4, 0x64, 0xaa, 0x4f, 0xfe, 0xc7, 0x22, 0x44,
+  0x9a, 0x40, 0xac, 0x44, 0x9a, 0x2e, 0xdb, 0xc9, 0x6a, 0x57, 0x98, 0xa8, 0x6c, 0x19, 0x7c, 0xaf,
+  0xe6, 0x01, 0x70, 0x2a, 0x48, 0xdf, 0xf1, 0x77, 0xf4, 0xc8, 0x64, 0x10, 0xac, 0xd1, 0xed, 0x76,
+  0x1b, 0x86, 0x93, 0xf8, 0x7a, 0x27, 0xa4, 0xab, 0x6e, 0x39, 0xda, 0xa8, 0x1f, 0x46, 0x9a, 0xfe,
+  0x96, 0x12, 0xe0, 0x90, 0xf5, 0xcb, 0xf9, 0xff, 0xa4, 0x8d, 0x51, 0xe4, 0xa3, 0x7b, 0x81, 0x26,
+  0xbe, 0x80, 0xc4, 0x88, 0x08, 0xd0, 0x57, 0x6c, 0xc5, 0xc1, 0xd2, 0x35, 0xe6, 0x5e, 0x90, 0x2d,
+  0x1b, 0xf6, 0xa5, 0xd9, 0x2a, 0x24, 0x00, 0x3d, 0xe9, 0xbb, 0xbd, 0xbd, 0x16, 0xa8, 0xff, 0x93,
+  0x3d, 0x02, 0x9f, 0x25, 0x15, 0x68, 0x60, 0xcf, 0x23, 0xf0, 0xdb, 0xad, 0xde, 0x9e, 0xbb, 0x0e,
+  0x74, 0x3d, 0x83, 0x2f, 0xea, 0x0c, 0xbe, 0xbd, 0x31, 0x3c, 0xc6, 0x61, 0x95, 0xa0, 0x42, 0xe2,
+  0x4d, 0x3d, 0x3f, 0x2b, 0x0c, 0x87, 0xc8, 0xfc, 0xe5, 0xdc, 0xd6, 0x0f, 0x70, 0x18, 0xcd, 0xdb,
+  0x32, 0x6d, 0xab, 0xa1, 0x46, 0x19, 0x39, 0x26, 0x72, 0x69, 0x3c, 0xb8, 0xbd, 0x69, 0x3c, 0xaa,
+  0x18, 0x74, 0x86, 0xb0, 0x8e, 0xe2, 0xbe, 0x7b, 0x4f, 0x54, 0x6f, 0xd0, 0x15, 0xf4, 0x6a, 0xdf,
+  0x4a, 0xbb, 0x4d, 0xf9, 0xeb, 0x4d, 0xa4, 0xcf, 0x2a, 0xb4, 0xbf, 0x54, 0x1c, 0xc6, 0x53, 0x91,
+  0x28, 0x9f, 0x8f, 0xf1, 0x3c, 0x83, 0xa7, 0xf4, 0xc2, 0x16, 0xe3, 0x98, 0x51, 0xb5, 0xe9, 0x08,
+  0xc5, 0x1a, 0x52, 0x2f, 0x25, 0xd2, 0x98, 0xc2, 0xe0, 0xe8, 0x3e, 0x1f, 0x08, 0x2c, 0x05, 0x94,
+  0x3d, 0x82, 0xdd, 0x5f, 0x57, 0xeb, 0x81, 0xf6, 0x35, 0x50, 0xaf, 0x3e, 0x5e, 0x39, 0xc0, 0xd5,
+  0xa9, 0x5d, 0x85, 0x29, 0xa4, 0xed, 0xb6, 0x79, 0x94, 0x41, 0xcd, 0xb6, 0xa0, 0x23, 0x9c, 0x62,
+  0x98, 0x64, 0xc5, 0xa4, 0x8a, 0xba, 0x57, 0xf8, 0x31, 0x12, 0x99, 0x25, 0x2e, 0xac, 0x5c, 0xd5,
+  0x37, 0x6a, 0x45, 0x45, 0xb1, 0xaa, 0x3b, 0xfa, 0xb4, 0x7c, 0x7b, 0xfb, 0xfc, 0xd4, 0xf6, 0xbd,
+  0x29, 0x0b, 0x7c, 0x26, 0x94, 0xff, 0x49, 0xb1, 0x9c, 0x30, 0xa7, 0x88, 0xf8, 0x92, 0x9f, 0x7e,
+  0xc7, 0x0e, 0xaf, 0xf7, 0xb0, 0x1d, 0x13, 0x76, 0xc7, 0xb1, 0xae, 0x37, 0x5b, 0x56, 0xb7, 0xa5,
+  0x09, 0x16, 0xd0, 0x54, 0x5f, 0x77, 0xf4, 0xbb, 0x76, 0x58, 0xeb, 0xab, 0x77, 0x00, 0xf1, 0x29,
+  0x0f, 0x17, 0x7c, 0x99, 0xa2, 0xe3, 0xea, 0x6f, 0x33, 0xf9, 0x93, 0x17, 0x4a, 0xef, 0x56, 0xd3,
+  0x8e, 0xde, 0x2b, 0xb5, 0xde, 0xb6, 0x33, 0xb5, 0x92, 0x07, 0xc4, 0x24, 0x3c, 0xb4, 0x11, 0xe1,
+  0x7d, 0xdb, 0x18, 0xa9, 0x9a, 0xd0, 0x2b, 0x93, 0xd9, 0x9a, 0xa6, 0x01, 0x9d, 0xc1, 0x06, 0x7e,
+  0x1b, 0x09, 0x6a, 0xe3, 0x05, 0x54, 0x1b, 0xb9, 0xd1, 0x56, 0x4a, 0x6e, 0xce, 0xaf, 0xd6, 0xaa,
+  0xe8, 0x60, 0xa5, 0x1a, 0x52, 0x6c, 0xec, 0xb0, 0x80, 0x4e, 0x35, 0x4c, 0x94, 0xfc, 0x50, 0x30,
+  0xf7, 0xf1, 0xa4, 0x14, 0x18, 0x0b, 0x8a, 0x7c, 0x5d, 0x8b, 0xdc, 0x44, 0x4b, 0x11, 0x75, 0xdf,
+  0x2a, 0xce, 0x81, 0xce, 0xb6, 0xe9, 0x55, 0xf0, 0xf2, 0x30, 0x98, 0x54, 0x5a, 0x98, 0x0b, 0x54,
+  0x4d, 0x38, 0x32, 0x9a, 0x74, 0xa4, 0x38, 0x89, 0xb5, 0x88, 0x7e, 0x89, 0xa0, 0x04, 0x36, 0x43,
+  0x3d, 0xd0, 0xb0, 0x14, 0xff, 0x62, 0x6c, 0x1c, 0xca, 0xe4, 0x7b, 0x91, 0x20, 0x6b, 0x9b, 0x15,
+  0xf6, 0x14, 0xb7, 0x3c, 0x3f, 0x14, 0xd3, 0xef, 0x98, 0x7a, 0xa5, 0x13, 0xfc, 0x6f, 0xbc, 0x52,
+  0x29, 0x3e, 0x61, 0xe5, 0x5b, 0xa0, 0x0f, 0x06, 0xc8, 0xc0, 0x6f, 0x75, 0x41, 0x2a, 0xc7, 0x19,
+  0xc4, 0xa6, 0x71, 0x9e, 0x61, 0xd1, 0x57, 0xeb, 0x73, 0x87, 0xaa, 0xe5, 0x0e, 0x79, 0xa4, 0x9a,
+  0xdd, 0x5b, 0x83, 0x8d, 0xf7, 0x9c, 0x6f, 0x0b, 0x05, 0x6b, 0x1b, 0xc7, 0x44, 0x4c, 0xab, 0xf1,
+  0x4c, 0xbd, 0x8e, 0xac, 0x4c, 0xbe, 0xc2, 0xb7, 0xc2, 0xb6, 0xac, 0xf3, 0x8e, 0x1a, 0x4f, 0xdc,
+  0x3a, 0x47, 0x88, 0x25, 0xcc, 0x05, 0xd7, 0x05, 0xcf, 0xd7, 0xb3, 0x86, 0xf5, 0xb6, 0x07, 0xeb,
+  0x99, 0x33, 0xe3, 0xe1, 0xa4, 0x30, 0xa3, 0x7f, 0x07, 0x97, 0xbe, 0x1c, 0x5d, 0xf1, 0xb2, 0x06,
+  0x20, 0x68, 0x3c, 0xc0, 0x64, 0xb6, 0x96, 0xc9, 0x9d, 0x55, 0xcd, 0xd4, 0x5c, 0x56, 0x3e, 0x17,
+  0x14, 0x4d, 0xbf, 0x34, 0x6b, 0xef, 0xb6, 0x3c, 0x2a, 0x5b, 0xc3, 0x65, 0x54, 0x3e, 0x8b, 0xcd,
+  0x8a, 0xcf, 0xf0, 0x14, 0x38, 0xed, 0x6e, 0x7d, 0x01, 0x9b, 0x1f, 0xe4, 0xf3, 0xbf, 0x96, 0xcd,
+  0xdf, 0xc8, 0xe5, 0xe2, 0x45, 0xe1, 0x26, 0xc4, 0xe7, 0x36, 0x68, 0x1d, 0x9d, 0x94, 0x37, 0x3b,
+  0xfd, 0x76, 0xbf, 0xa5, 0x2b, 0xe1, 0x6a, 0x2c, 0xae, 0x46, 0x5c, 0xc5, 0xe4, 0xa8, 0x83, 0x37,
+  0xe8, 0xf4, 0xaa, 0x15, 0xc6, 0xb1, 0x58, 0x71, 0x90, 0xb9, 0x78, 0xb4, 0xb0, 0xe2, 0xfd, 0x36,
+  0xd9, 0x76, 0x99, 0x02, 0xc7, 0xc0, 0x51, 0x34, 0x83, 0x27, 0x58, 0x11, 0xf4, 0x58, 0x13, 0xa6,
+  0x74, 0x60, 0x6e, 0xd9, 0xfa, 0x44, 0x92, 0xa2, 0x24, 0x08, 0x1e, 0xab, 0x13, 0x08, 0x98, 0xd3,
+  0x8c, 0xdb, 0x60, 0x36, 0x94, 0xd1, 0x9b, 0x56, 0x05, 0xf5, 0x7f, 0x15, 0x08, 0x52, 0x51, 0xd0,
+  0x62, 0x42, 0x53, 0x1c, 0x99, 0xd0, 0x74, 0xd8, 0x33, 0x2f, 0x27, 0x1c, 0xf6, 0xd4, 0x8b, 0xf6,
+  0x87, 0x3d, 0xf5, 0x7f, 0x6f, 0xf9, 0x5f, 0x9e, 0xa7, 0x27, 0xda, 0xce, 0x45, 0x00, 0x00,
+};
@@ -0,0 +1,26 @@
+/*
+
+    Store.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define STORE_FILE "/fs/solis"                // append only record log on the WiFi module flash
+#define STORE_TEMP "/fs/solis.new"            // compacted log being written
+#define STORE_BUFFER 256                      // records batched in RAM before a flash write
+#define STORE_INTERVAL 15*60000UL             // write batched records at least this often
+#define STORE_MAX 32768                       // log bytes before it is compacted to a snapshot
+#define STORE_MAGIC 0xA5                      // first byte of every record
+
+//  Record types
+//
+#define REC_REGISTERS 1                       // the whole register set - address, size, flags, interval
+#define REC_KEEP 2                            // history tiers kept for an address
+#define REC_POINT 3                           // one closed history point
+#define REC_RING 4                            // a whole history tier ring, written by compaction
+#define REC_VIRTUAL 5                         // a virtual register definition, empty to remove
+#define REC_DEVICE_REGISTERS 6                // registers on other modbus devices - device, address, size, flags, interval
+
+bool storeDirty;                              // register set changed since it was last stored
@@ -0,0 +1,367 @@
+/*
+
+    Store
+    https://github.com/RichardL64
+
+    Keep the register set and history across power cuts, in a file on the WiFi module flash
+
+    An append only log of records:
+      magic, type, length (2 bytes), payload, CRC16 of type, length & payload
+    values little endian.
+
+    Records are batched in RAM and written every STORE_INTERVAL, or as the batch fills,
+    so the flash sees a few hundred bytes every 15 minutes rather than a write per sample.
+    Past STORE_MAX bytes the log is rewritten as a snapshot - virtual registers, register set, history kept and rings -
+    to a new file renamed over the old one.
+
+    On boot the log is replayed in order, later records override earlier ones.
+    Replay stops at the first bad magic or CRC, a write cut short by the power going, and the log is compacted.
+    History periods restart from boot, time the power was off is not in the history.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+byte storeBuffer[STORE_BUFFER];               // records batched for writing, or a read window during replay
+int storeLength;                              // bytes batched
+const char *storeFile = STORE_FILE;           // file being written
+uint32_t storeSize;                           // bytes in the file
+unsigned long storeSaved;                     // millis last written
+word storeCRC;                                // running CRC of the record being written
+
+uint32_t storeWindow;                         // file offset of the read window
+int storeWindowLength;
+
+//  Replay the log into the register cache and history
+//  Called from setup once the WiFi module is up
+//
+void storeBegin() {
+  if(!WiFiStorage.exists(STORE_FILE)
+   && WiFiStorage.exists(STORE_TEMP)) WiFiStorage.rename(STORE_TEMP, STORE_FILE); // cut off mid compaction
+
+  uint32_t size = 0;
+  if(!WiFiStorage.exists(STORE_FILE, &size)) size = 0;
+
+  storeSize = size;
+  storeWindowLength = 0;
+  uint32_t pos = 0;
+  while(pos < size) {
+    uint32_t next = storeCheck(pos);
+    if(next == 0) break;                                    // damaged from here on
+    storeApply(pos);
+    pos = next;
+  }
+
+  storeSize = pos;
+  storeLength = 0;
+  storeDirty = false;                                       // the set just loaded is the stored set
+  storeSaved = millis();
+
+  LOG_I("Store replayed %lu of %lu bytes", (unsigned long)pos, (unsigned long)size);
+
+  if(pos < size) storeCompact();                            // rewrite without the damage
+}
+
+//  Write the batch and the register set if it changed, compact the log when it gets big
+//  Called from the main loop
+//
+void storeTick() {
+  if(millis() - storeSaved < STORE_INTERVAL) return;
+  storeSaved = millis();
+
+  if(storeDirty) storeRegisters();
+  storeFlush();
+  if(storeSize > STORE_MAX) storeCompact();
+}
+
+//  Rewrite the log as a snapshot of what is in memory
+//  Anything batched is already in memory so is dropped
+//
+void storeCompact() {
+  storeLength = 0;
+  storeFile = STORE_TEMP;
+  storeSize = 0;
+  WiFiStorage.remove(STORE_TEMP);
+
+  for(int v = 0; v < VIRTUAL_SIZE; v++) {
+    if(virtualRegs[v].address != 0) storeVirtual(virtualRegs[v].address);
+  }
+  storeRegisters();
+  for(int h = 0; h < HISTORY_CACHE_SIZE; h++) {
+    if(histCache[h].address == 0) continue;
+    storeKeep(h);
+    for(int t = 0; t < HISTORY_TIERS; t++) {
+      if(histCache[h].tier[t].points > 0) storeRing(h, t);
+    }
+  }
+  storeFlush();
+
+  WiFiStorage.remove(STORE_FILE);
+  WiFiStorage.rename(STORE_TEMP, STORE_FILE);
+  storeFile = STORE_FILE;
+
+  LOG_I("Store compacted to %lu bytes", (unsigned long)storeSize);
+}
+
+//  Record types
+//  Address, size, flags & interval of every cached register
+//  Registers on other devices follow with their device, replayed after the inverter's
+//
+void storeRegisters() {
+  int n = 0, other = 0;
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address == 0) continue;
+    if(regCache[i].address >> KEY_DEVICE == 0) n++;
+    else other++;
+  }
+
+  storeOpen(REC_REGISTERS, n * 8);
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    if(regCache[i].address == 0 || regCache[i].address >> KEY_DEVICE != 0) continue;
+    storePut(regCache[i].address, 2);
+    storePut(regCache[i].size, 1);
+    storePut(regCache[i].flags, 1);
+    storePut(regCache[i].interval, 4);
+  }
+  storeClose();
+
+  if(other > 0) {
+    storeOpen(REC_DEVICE_REGISTERS, other * 9);
+    for(int i = 0; i < CACHE_SIZE; i++) {
+      if(regCache[i].address >> KEY_DEVICE == 0) continue;
+      storePut(regCache[i].address >> KEY_DEVICE, 1);
+      storePut(regCache[i].address, 2);
+      storePut(regCache[i].size, 1);
+      storePut(regCache[i].flags, 1);
+      storePut(regCache[i].interval, 4);
+    }
+    storeClose();
+  }
+  storeDirty = false;
+}
+
+//  Address and a bit per tier kept
+//
+void storeKeep(int h) {
+  byte keep = 0;
+  for(int t = 0; t < HISTORY_TIERS; t++) {
+    if(histCache[h].keep[t]) keep |= 1 << t;
+  }
+
+  storeOpen(REC_KEEP, 3);
+  storePut(histCache[h].address, 2);
+  storePut(keep, 1);
+  storeClose();
+}
+
+//  A point just closed into a tier
+//
+void storePoint(int h, int t, long mean, long low, long high) {
+  storeOpen(REC_POINT, 15);
+  storePut(histCache[h].address, 2);
+  storePut(t, 1);
+  storePut(mean, 4);
+  storePut(low, 4);
+  storePut(high, 4);
+  storeClose();
+}
+
+//  A tier ring as it stands, the encoded bytes oldest first
+//
+void storeRing(int h, int t) {
+  historyTier &tier = histCache[h].tier[t];
+  word size = historyOffset[t +1] - historyOffset[t];
+
+  storeOpen(REC_RING, 15 + tier.used);
+  storePut(histCache[h].address, 2);
+  storePut(t, 1);
+  storePut(tier.base, 4);
+  storePut(tier.last, 4);
+  storePut(tier.points, 2);
+  storePut(tier.used, 2);
+  for(word b = 0; b < tier.used; b++) {
+    storePut(histCache[h].data[historyOffset[t] + (tier.first + b) % size], 1);
+  }
+  storeClose();
+}
+
+//  Address and expression text, none if it's no longer defined
+//
+void storeVirtual(int address) {
+  int v = virtualFind(address);
+  const char *text = v == -1 ? "" : virtualRegs[v].text;
+
+  storeOpen(REC_VIRTUAL, 2 + strlen(text));
+  storePut(address, 2);
+  while(*text != '\0') storePut(*text++, 1);
+  storeClose();
+}
+
+//  Apply a checked record at pos
+//  Unknown types are skipped so older firmware can read a newer log
+//
+void storeApply(uint32_t pos) {
+  byte type = storeRead(pos +1);
+  pos += 4;
+
+  switch(type) {
+    case REC_REGISTERS:
+    case REC_DEVICE_REGISTERS: {
+      uint32_t end = pos + (storeRead(pos -2) | storeRead(pos -1) << 8);
+      if(type == REC_REGISTERS) stopAll();                  // the newest set replaces any earlier one
+      while(pos < end) {
+        int device = type == REC_DEVICE_REGISTERS ? storeGet(pos, 1) : MODBUS_DEVICE;
+        int address = registerKey(device, storeGet(pos, 2));
+        int size = storeGet(pos, 1);
+        byte flags = storeGet(pos, 1);
+        unsigned long interval = storeGet(pos, 4);
+        int i = registerIndex(address, size);
+        if(i == -1) continue;                               // smaller cache than the one saved
+        regCache[i].flags = flags;
+        regCache[i].interval = interval;
+      }
+      break;
+    }
+
+    case REC_KEEP: {
+      int h = historySlot(storeGet(pos, 2));
+      byte keep = storeGet(pos, 1);
+      if(h == -1) break;                                    // full
+      for(int t = 0; t < HISTORY_TIERS; t++) histCache[h].keep[t] = keep >> t & 1;
+      break;
+    }
+
+    case REC_POINT: {
+      int h = historyIndex(storeGet(pos, 2));
+      int t = storeGet(pos, 1);
+      long mean = storeGet(pos, 4);
+      long low = storeGet(pos, 4);
+      long high = storeGet(pos, 4);
+      if(h != -1 && t < HISTORY_TIERS) historyStore(h, t, mean, low, high);
+      break;
+    }
+
+    case REC_VIRTUAL: {
+      uint32_t end = pos + (storeRead(pos -2) | storeRead(pos -1) << 8);
+      int address = storeGet(pos, 2);
+      char text[VIRTUAL_TEXT];
+      int l = 0;
+      while(pos < end && l < VIRTUAL_TEXT -1) text[l++] = storeGet(pos, 1);
+      text[l] = '\0';
+      virtualDefine(address, text);
+      break;
+    }
+
+    case REC_RING: {
+      int h = historyIndex(storeGet(pos, 2));
+      int t = storeGet(pos, 1);
+      if(h == -1 || t >= HISTORY_TIERS) break;
+
+      historyTier &tier = histCache[h].tier[t];
+      long base = storeGet(pos, 4);
+      long last = storeGet(pos, 4);
+      word points = storeGet(pos, 2);
+      word used = storeGet(pos, 2);
+      if(used > historyOffset[t +1] - historyOffset[t]) break;
+
+      tier.base = base;
+      tier.last = last;
+      tier.points = points;
+      tier.used = used;
+      tier.first = 0;
+      tier.closed = millis();
+      for(word b = 0; b < used; b++) histCache[h].data[historyOffset[t] + b] = storeGet(pos, 1);
+      break;
+    }
+  }
+}
+
+//  Check the record at pos
+//  Returns the offset of the next record, or 0 if this one is damaged
+//
+uint32_t storeCheck(uint32_t pos) {
+  if(storeRead(pos) != STORE_MAGIC || pos + 6 > storeSize) return 0;
+
+  uint32_t end = pos + 4 + (storeRead(pos +2) | storeRead(pos +3) << 8);
+  if(end + 2 > storeSize) return 0;                         // cut short
+
+  word crc = 0xFFFF;
+  for(uint32_t p = pos +1; p < end; p++) crc = crc16(crc, storeRead(p));
+  if((storeRead(end) | storeRead(end +1) << 8) != crc) return 0;
+
+  return end + 2;
+}
+
+//  Read a little endian value, advancing pos
+//
+unsigned long storeGet(uint32_t &pos, int bytes) {
+  unsigned long value = 0;
+  for(int b = 0; b < bytes; b++) value |= (unsigned long)storeRead(pos++) << (8 * b);
+  return value;
+}
+
+//  Read one byte of the file through a window of storeBuffer
+//  -1 past the end or on a read error
+//
+int storeRead(uint32_t pos) {
+  if(pos >= storeSize) return -1;
+
+  if(pos < storeWindow || pos >= storeWindow + storeWindowLength) {
+    storeWindow = pos;
+    storeWindowLength = storeSize - pos < STORE_BUFFER ? storeSize - pos : STORE_BUFFER;
+    if(!WiFiStorage.read(STORE_FILE, pos, storeBuffer, storeWindowLength)) {
+      storeWindowLength = 0;
+      return -1;
+    }
+  }
+  return storeBuffer[pos - storeWindow];
+}
+
+//  Start a record, the payload follows from storePut then storeClose
+//
+void storeOpen(byte type, word length) {
+  storeByte(STORE_MAGIC);
+  storeCRC = 0xFFFF;
+  storePut(type, 1);
+  storePut(length, 2);
+}
+
+//  Add a little endian value to the record
+//
+void storePut(unsigned long value, int bytes) {
+  for(int b = 0; b < bytes; b++) {
+    storeCRC = crc16(storeCRC, (byte)value);
+    storeByte(value);
+    value >>= 8;
+  }
+}
+
+void storeClose() {
+  word crc = storeCRC;
+  storeByte(crc);
+  storeByte(crc >> 8);
+}
+
+//  Batch a byte, writing the batch when full
+//
+void storeByte(byte b) {
+  if(storeLength == STORE_BUFFER) storeFlush();
+  storeBuffer[storeLength++] = b;
+}
+
+//  Append the batch to the file
+//
+void storeFlush() {
+  if(storeLength == 0) return;
+  WiFiStorage.write(storeFile, storeSize, storeBuffer, storeLength);
+  storeSize += storeLength;
+  storeLength = 0;
+}
+
+//  CRC16, the Modbus polynomial
+//
+word crc16(word crc, byte b) {
+  crc ^= b;
+  for(int i = 0; i < 8; i++) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+  return crc;
+}
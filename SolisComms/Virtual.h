@@ -0,0 +1,20 @@
+/*
+
+    Virtual.h
+    https://github.com/RichardL64
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define VIRTUAL_SIZE 8                        // virtual register definitions
+#define VIRTUAL_TEXT 48                       // expression source chars
+
+//  Registers computed from other registers
+//
+struct {
+    int address;                              // 0 = unused
+    char text[VIRTUAL_TEXT];                  // source, for listing and the store
+    expression expr;
+    unsigned long evaluated;                  // cacheSequence when last evaluated
+} virtualRegs[VIRTUAL_SIZE];
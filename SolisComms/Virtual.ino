@@ -0,0 +1,123 @@
+/*
+
+    Virtual
+    https://github.com/RichardL64
+
+    Virtual registers - values computed on the Arduino from other registers, served through /R like real ones
+    Saves every client fetching the raw registers and repeating the arithmetic
+
+    Defined by an Expression, the defaults below or /V?address=<value>&expr=<expression>
+    Once requested a virtual register keeps its inputs in the register cache and is
+    re-evaluated after a poll only when one of their values has changed.
+    Virtual registers may use earlier virtual registers as inputs.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+//  Built in definitions, the calculated dashboard fields
+//
+const struct {
+  int address;
+  const char *text;
+} virtualDefault[] = {
+  {33303, "r33139*70/100"},                             // battery kWh x10, 7kWh battery
+  {33305, "r33149.2*(1-2*r33135)"},                     // battery watts, -ve discharging
+  {33304, "max(r33303*100-1400,0)*60/max(-r33305,0)"},  // minutes to 20% charge at the current discharge, 0 charging
+};
+
+//  Load the built in definitions
+//  Called from setup before the store replays any changes
+//
+void virtualBegin() {
+  for(unsigned int d = 0; d < sizeof(virtualDefault) / sizeof(virtualDefault[0]); d++) {
+    virtualDefine(virtualDefault[d].address, virtualDefault[d].text);
+  }
+}
+
+//  Add or replace a definition, an empty expression removes it
+//  Returns false if the expression doesn't compile or the table is full
+//
+bool virtualDefine(int address, const char *text) {
+  int v = virtualFind(address);
+
+  if(text[0] == '\0') {                                 // remove
+    if(v != -1) virtualRegs[v].address = 0;
+    stopRegister(address);
+    return true;
+  }
+
+  expression expr;
+  if(strlen(text) >= VIRTUAL_TEXT || !exprCompile(text, expr)) return false;
+
+  if(v == -1) {
+    for(int n = 0; n < VIRTUAL_SIZE && v == -1; n++) {
+      if(virtualRegs[n].address == 0) v = n;
+    }
+    if(v == -1) return false;                           // full
+  }
+
+  virtualRegs[v].address = address;
+  strcpy(virtualRegs[v].text, text);
+  virtualRegs[v].expr = expr;
+  virtualRegs[v].evaluated = 0;                         // evaluate next time
+
+  int i = cacheFind(address);                           // already cached as a real register
+  if(i != -1) regCache[i].flags |= REG_VIRTUAL;
+  return true;
+}
+
+//  Return the definition index for the address, or -1 if not virtual
+//
+int virtualFind(int address) {
+  for(int v = 0; v < VIRTUAL_SIZE; v++) {
+    if(virtualRegs[v].address == address) return v;
+  }
+  return -1;
+}
+
+//  Re-evaluate requested virtual registers whose inputs changed
+//  Inputs are kept in the cache for as long as the virtual register is requested
+//  Called after each poll
+//
+void virtualUpdate() {
+  for(int v = 0; v < VIRTUAL_SIZE; v++) {
+    if(virtualRegs[v].address == 0) continue;
+    int i = cacheFind(virtualRegs[v].address);
+    if(i == -1) continue;                               // not requested
+
+    expression &e = virtualRegs[v].expr;
+    bool changed = virtualRegs[v].evaluated == 0;
+    for(int n = 0; n < e.inputs; n++) {
+      int j = registerOwn(e.input[n], e.size[n]);
+      if(j == -1) continue;                             // cache full, evaluates as no data
+      if((long)(regCache[i].age - regCache[j].age) > 0) cacheTouch(j);
+      if(regCache[j].version > virtualRegs[v].evaluated) changed = true;
+    }
+    if(!changed) continue;
+
+    virtualRegs[v].evaluated = cacheSequence;
+    long value = 0;
+    int state = exprEvaluate(e, value);
+    setCache(i, value, state);
+    if(state == STATE_VALID) setHistory(virtualRegs[v].address, value);
+  }
+}
+
+//  List the definitions as JSON
+//
+//  {"33303":"r33139*70/100","33304":"..."}
+//
+void virtualJSON(HttpWriter &out) {
+  out.write('{');
+  for(int v = 0, n = 0; v < VIRTUAL_SIZE; v++) {
+    if(virtualRegs[v].address == 0) continue;
+    if(n++ > 0) out.write(',');
+    out.write('"');
+    out.writeLong(virtualRegs[v].address);
+    out.print("\":\"");
+    out.print(virtualRegs[v].text);
+    out.write('"');
+  }
+  out.write('}');
+}
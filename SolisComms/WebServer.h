@@ -9,5 +9,240 @@
 
 #include "SolisDashboard.html.h"
 
+#define HTTP_PRINT_CHUNK 1024                 // max bytes per client write, WiFi client trashes data over ~4k
+#define HTTP_CONNECTIONS 6                    // clients serviced concurrently
+#define HTTP_LINE_SIZE 256                    // request line limit, longer is refused
+#define HTTP_TIMEOUT 2000                     // ms allowed to send a complete request
+#define HTTP_READ_CHUNK 64                    // bytes read from a client at a time
+#define HTTP_HEADER_SIZE 64                   // header line chars kept for interpretation
+#define HTTP_KEEPALIVE 3                      // idle connections kept open for another request
+#define HTTP_IDLE 5000                        // ms an idle kept connection waits for its next request
+#define HTTP_PARAMS 8                         // query parameters kept per request, more are ignored
+
+#define MEMO_SIZE 2                           // /R responses remembered
+#define MEMO_BODY 512                         // longest body remembered
+#define MEMO_INDEXES 32                       // most registers in a remembered response
+
+#define ADDRESS_INVALID -1                    // parseAddress result for a device outside 1..247 or an address over 0xFFFF
+
+#define EVENT_CONNECTIONS (HTTP_CONNECTIONS -1) // event streams open at once, leaves a slot for requests
+#define EVENT_ADDRESSES 16                    // registers per event stream
+#define EVENT_ALIVE 3000                      // ms between alive events, also detects dropped clients
+
+#define CONN_FREE 0                           // slot unused
+#define CONN_REQUEST 1                        // reading the request line
+#define CONN_HEADERS 2                        // reading header lines until a blank line
+#define CONN_RESPOND 3                        // request complete, ready to respond
+#define CONN_EVENTS 4                         // event stream open, pushing register changes
+#define CONN_IDLE 5                           // kept alive, waiting for the next request
+
+#define REQ_ETAG_MATCH 0x01                   // If-None-Match has the current dashboard ETag
+#define REQ_HOST_NAME 0x02                    // Host is a name, not an IP address
+#define REQ_CLOSE 0x04                        // Connection: close
+#define REQ_KEEPALIVE 0x08                    // Connection: keep-alive, needed by HTTP/1.0
+#define REQ_HTTP10 0x10                       // HTTP/1.0 request line
+
+#define FRAME_NONE 0                          // HttpWriter output as is
+#define FRAME_PENDING 1                       // header held until the body is complete or overflows the buffer
+#define FRAME_CHUNKED 2                       // header sent, body in chunks
+
+//  Client connection state, filled incrementally as bytes arrive
+//
+struct httpConnection {
+    WiFiClient client;
+    byte state;                               // CONN_
+    unsigned long start;                      // millis when accepted
+    int length;                               // request line length so far
+    int header;                               // current header line length so far
+    bool overflow;                            // request line too long
+    byte flags;                               // REQ_ interpreted from the headers
+    bool keep;                                // response framed, connection can be kept open
+    char line[HTTP_LINE_SIZE];                // request line "GET /... HTTP/1.1", split by httpParse
+    char headerLine[HTTP_HEADER_SIZE];        // current header line, truncated
+    char received[HTTP_READ_CHUNK];           // last read from the client, may run into a pipelined request
+    int next;                                 // received bytes used so far
+    int count;                                // received bytes
+
+    int events;                               // event stream registers
+    unsigned long lastEvent;                  // millis last event sent
+    unsigned long eventSequence;              // cacheSequence when last sent
+    int eventAddress[EVENT_ADDRESSES];
+    byte eventSize[EVENT_ADDRESSES];
+} connections[HTTP_CONNECTIONS];
+
+//  A request line split in place, "GET /R?lease=60&address=33057.2 HTTP/1.1"
+//  Each part points into the connection's line, the separators overwritten with \0
+//
+struct httpRequest {
+    const char *method;                       // "GET"
+    const char *path;                         // "/R"
+    const char *end;                          // where the query ended, path to end is the whole URL
+    const char *aliases;                      // the route's single letter parameter names, see httpRoute
+    int params;
+    const char *param[HTTP_PARAMS];           // "lease=60", "address=33057.2"
+};
+
+//  A path and the function that responds to it
+//  Parameters can be passed by a single letter alias, "a:address l:lease" takes /R?a=33057.2&l=60
+//
+struct httpRoute {
+    const char *path;
+    const char *aliases;
+    void (*handler)(httpConnection &conn, httpRequest &req);
+};
+
+//  A rendered /R response body and the cache entries it was rendered from, see Memo
+//
+struct responseMemo {
+    unsigned long hash;                       // of the request URL
+    unsigned long cycle;                      // snapshot rendered from, a newer one invalidates it
+    unsigned long layout;                     // cacheLayout when rendered
+    unsigned long used;                       // millis last rendered or replayed
+    bool ready;                               // body complete
+    int length;                               // body bytes, -1 too long to keep
+    byte count;
+    cacheIndex index[MEMO_INDEXES];           // cache entries in the response
+    char body[MEMO_BODY];
+};
+
+//  Buffered response output
+//  Collects small prints into HTTP_PRINT_CHUNK sized client writes, call flush() when done
+//  Optionally copies what is written into a responseMemo
+//
+//  Framed, after frame(), the 200 header is written by the writer - call end() when done.
+//  A body that fits the buffer is sent with a Content-Length, a longer one chunked,
+//  so the client knows where the response ends without the connection closing.
+//  Chunked is HTTP/1.1 only, to an HTTP/1.0 client or on a connection not being kept
+//  a longer body has no length and the close ends it - keep is cleared to match.
+//
+class HttpWriter : public Print {
+  public:
+    HttpWriter(WiFiClient &client) : client(client), length(0), memo(0), framing(FRAME_NONE) {}
+
+    void frame(const char *type, int refresh, bool &keep, bool http10) {
+      framing = FRAME_PENDING;
+      this->type = type;
+      this->refresh = refresh;
+      this->keep = &keep;
+      this->http10 = http10;
+    }
+
+    void end() {
+      if(framing == FRAME_PENDING) {
+        header(length);
+        framing = FRAME_NONE;
+      }
+      flush();
+      if(framing == FRAME_CHUNKED) client.print(F("0\r\n\r\n"));
+      framing = FRAME_NONE;
+    }
+
+    void capture(responseMemo *m) {
+      memo = m;
+    }
+
+    size_t write(uint8_t c) {
+      if(length == HTTP_PRINT_CHUNK) flush();
+      buffer[length++] = c;
+      return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t size) {
+      for(size_t left = size; left > 0; ) {
+        if(length == HTTP_PRINT_CHUNK) flush();
+        size_t n = min(left, (size_t)(HTTP_PRINT_CHUNK - length));
+        memcpy(buffer + length, data, n);
+        length += n;
+        data += n;
+        left -= n;
+      }
+      return size;
+    }
+    using Print::write;
+
+    //  Decimal digits straight into the buffer
+    //
+    void writeLong(long value) {
+      if(length > HTTP_PRINT_CHUNK - 11) flush();           // room for "-2147483648"
+      unsigned long v = value;
+      if(value < 0) {
+        buffer[length++] = '-';
+        v = -v;
+      }
+      int first = length;
+      do {
+        buffer[length++] = '0' + v % 10;
+        v /= 10;
+      } while(v != 0);
+      for(int last = length -1; first < last; first++, last--) {   // digits were least significant first
+        uint8_t c = buffer[first];
+        buffer[first] = buffer[last];
+        buffer[last] = c;
+      }
+    }
+
+    void flush() {
+      if(framing == FRAME_PENDING) {                        // too long for a Content-Length
+        framing = *keep && !http10 ? FRAME_CHUNKED : FRAME_NONE;
+        if(framing == FRAME_NONE) *keep = false;            // ended by the close
+        header(-1);
+      }
+      if(framing == FRAME_CHUNKED && length > 0) {
+        client.print(length, HEX);
+        client.print(F("\r\n"));
+      }
+      if(length > 0) client.write(buffer, length);
+      if(framing == FRAME_CHUNKED && length > 0) client.print(F("\r\n"));
+
+      if(memo != 0 && memo->length >= 0) {
+        if(memo->length + length <= MEMO_BODY) {
+          memcpy(memo->body + memo->length, buffer, length);
+          memo->length += length;
+        } else {
+          memo->length = -1;                                // too long to keep
+        }
+      }
+      length = 0;
+    }
+
+  private:
+    //  The header, with the body length or -1 for chunked or none
+    //
+    void header(long body) {
+      client.print(http10 ? F("HTTP/1.0 200 OK\r\nContent-Type: ") : F("HTTP/1.1 200 OK\r\nContent-Type: "));
+      client.print(type);
+      if(body >= 0) {
+        client.print(F("\r\nContent-Length: "));
+        client.print(body);
+      } else if(framing == FRAME_CHUNKED) {
+        client.print(F("\r\nTransfer-Encoding: chunked"));
+      }
+      client.print(*keep ? F("\r\nConnection: keep-alive") : F("\r\nConnection: close"));
+      client.print(F("\r\nAccess-Control-Allow-Origin: *\r\n"));    // CORS allow cross site retreival
+      if(refresh != 0) {                                    // Optional automatic refresh
+        client.print(F("Refresh: "));
+        client.print(refresh);
+        client.print(F("\r\n"));
+      }
+      client.print(F("\r\n"));
+    }
+
+    WiFiClient &client;
+    int length;
+    responseMemo *memo;
+    byte framing;                             // FRAME_
+    const char *type;
+    int refresh;
+    bool *keep;                               // the connection's, cleared if the close has to end the body
+    bool http10;
+    uint8_t buffer[HTTP_PRINT_CHUNK];
+};
+
+extern const httpRoute httpRoutes[];          // paths answered, see WebServer
+
 void httpHeader(WiFiClient client, int refresh=0);
+void httpBegin(httpConnection &conn, HttpWriter &out, int refresh = 0, const char *type = "text/html");
 void httpPrint(WiFiClient client, const char *data, int l = -1);
+unsigned long httpNumber(httpRequest &req, const char *name, unsigned long otherwise = 0);
+int parseAddress(const char *value, int &size, unsigned long &interval, const char **next = 0);
+bool validAddresses(const char *list);
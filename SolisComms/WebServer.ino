@@ -6,247 +6,678 @@
     Functions relating to web client interaction
     Interpreting and responding to HTTP requests
 
+    Framed responses - Content-Length or chunked - leave the connection open for the client's next request,
+    up to HTTP_KEEPALIVE idle connections for HTTP_IDLE ms each, so a client polling every few seconds reuses one socket.
+    Other responses, and clients sending Connection: close, are closed as before.
+    Chunked is for kept HTTP/1.1 connections only, any other long body is ended by the close.
+
+    The request line is split once in place by httpParse, routed by exact path through httpRoutes,
+    and parameters are found by name - bounded by the line and HTTP_PARAMS, nothing copied.
+
     No validation of inbound formats here, intended for running on a private/local network
 
     R.A.Lincoln       July 2022
 
 */
 
-#define HTTP_PRINT_CHUNK 1024
-#define CHAR_WAIT 100
-
-//  Check for a wifi client and service inbound HTTP requests
-//  Generally reads the first header line to create a response
-//  Other HTTP header instructions are ignored
+//  Check for wifi clients and service inbound HTTP requests
+//  Never waits on a client, each connection is advanced as far as the bytes received so far allow
+//  Generally the first header line creates the response, a few HTTP header lines are interpreted
 //
 void serviceWiFi() {
 
-  WiFiClient client = server.available();   // listen for incoming clients
-  if (!client) return;
-
-  Serial.print(F("new client "));
-  Serial.print(client.remoteIP());
-  Serial.print(":");
-  Serial.println(client.remotePort());
-
-  char line1[512];                                // line buffers
-  char lineN[512];
-   
-  nextLine(client, line1);                        // keep the first line "... GET etc...."
-  Serial.print(" ");
-  Serial.println(line1);
-  
-  nextLine(client, lineN);
-  while(lineN[0] != '\0') {                        // read the whole request - useful for debugging
-    Serial.print(" ");
-    Serial.println(lineN);
-    nextLine(client, lineN);
-  }
-
-  parseLine(client, line1);                       // functionality all from line1 
-  client.stop();                                  // disconnect
-  
-  Serial.println(F("client disconnected"));
-}
-
-//  Get the next line from the client
-//  No checks for available characters, just try reading them and check for -1
-//
-void nextLine(WiFiClient client, char *line) {
-    line[0] = '\0';
-    int pos = 0;
-
-    while (client.connected()) {            // loop while the client is connected
-
-      unsigned long cWait = millis();       // character timer
-      char c = client.read();               // try and get a character
-      switch (c) {
-        case 0xff:                          // -1 = no characters - ignore pending the timeout
-          if(millis() - cWait > CHAR_WAIT) 
-            return;                         // ==> took too long
-          delay(1);
-          break;
-          
-        case '\r':                          // carriage return - ignored
-          break;
-          
-        case '\n':                          // new line - end of record 'cr, lf' pair
-          return;                           // ==> done
-          break;
-          
-        default:                            // otherwise add the char to the line
-          line[pos++] = c;
-          line[pos] = '\0';
-          break;
-      }
+  WiFiClient client = server.available();         // listen for clients with data waiting
+  if (client) httpAccept(client);
 
-    }    
+  for(int c = 0; c < HTTP_CONNECTIONS; c++) {
+    if(connections[c].state == CONN_FREE) continue;
+    httpService(connections[c]);
+    rtuService();                                 // keep up with a modbus response arriving
+  }
 }
 
-//  Parse an inbound line from the client
-//  Creates any activity and HTML response required
+//  Track a new client in a free connection slot
+//  Clients already tracked are ignored - their data is read by httpService
+//  With no free slot the longest idle kept connection makes way
 //
-void parseLine(WiFiClient client, char *line) {
-  char name[50], value[50], json[512];          // general purose buffers
-      
-  //  Historic entry points - useful for basic testing
-  //
-  if(strstr(line, "GET /H") != 0){              // LED on
-    digitalWrite(LED_BUILTIN, HIGH);
-    httpHeader(client);
-    client.print(F("LED on"));
-    httpFooter(client);
+void httpAccept(WiFiClient &client) {
+  int free = -1, idle = -1;
+  for(int c = 0; c < HTTP_CONNECTIONS; c++) {
+    if(connections[c].state == CONN_FREE) {
+      if(free == -1) free = c;
+    } else if(connections[c].client == client) {
+      return;                                     // ==> already tracked
+    } else if(connections[c].state == CONN_IDLE
+           && (idle == -1 || (long)(connections[c].start - connections[idle].start) < 0)) {
+      idle = c;
+    }
+  }
+
+  if(free == -1 && idle != -1) {
+    httpClose(connections[idle]);
+    free = idle;
+  }
+  if(free == -1) {                                // no slots - refuse
+    client.stop();
     return;
   }
 
-  if(strstr(line,"GET /L") != 0){               // LED off
-    digitalWrite(LED_BUILTIN, LOW);
-    httpHeader(client);
-    client.print(F("LED off"));
-    httpFooter(client);
+  LOG_D("new client %s:%u", logAddress(client.remoteIP()), client.remotePort());
+
+  httpConnection &conn = connections[free];
+  conn.client = client;
+  conn.next = conn.count = 0;
+  httpReset(conn, CONN_REQUEST);
+}
+
+//  Ready the connection for a request
+//
+void httpReset(httpConnection &conn, byte state) {
+  conn.state = state;
+  conn.start = millis();
+  conn.length = 0;
+  conn.header = 0;
+  conn.overflow = false;
+  conn.flags = 0;
+  conn.keep = false;
+  conn.line[0] = '\0';
+}
+
+//  Read whatever has arrived from the client and respond once the request is complete
+//  Reading stops at the end of the request, anything after it is kept for the next one
+//  Stalled clients are dropped after HTTP_TIMEOUT
+//
+void httpService(httpConnection &conn) {
+  if(conn.state == CONN_EVENTS) {
+    eventsService(conn);
     return;
   }
 
-  //  The dashboard HTML is modified to insert the actual server IP address for callbacks.
-  //  We search for "<script>" and then "*** LIVE IP ADDRESS ***" then " to find the hostname
-  //  The HTML is read only so replacement is done dnymaically on writing
-  //
-  if(strstr(line, "GET / ") != 0
-    || strstr(line, "GET /dashboard") != 0) {                     // /dashboard?url=<value>
-    httpHeader(client);
-
-    char *url = strstr(dashboardHtml, "<script>");                // Script part of the HTML
-    url = strstr(url, "*** LIVE IP ADDRESS ***");
-    url = strstr(url, "\"") +1;                                   // leading "
-    char *quote = strstr(url, "\"");                              // following "
-
-    httpPrint(client, dashboardHtml, url - dashboardHtml);        // Print until the URL
-    client.print(WiFi.localIP());                                 // Insert the live IP address
-    httpPrint(client, quote);                                     // From the training quote to the end
-        
-    httpFooter(client);
+  if(conn.state == CONN_IDLE) {                   // kept alive
+    if(conn.next == conn.count && conn.client.available() == 0) {
+      if(!conn.client.connected()
+      || millis() - conn.start > HTTP_IDLE) httpClose(conn);
+      return;
+    }
+    httpReset(conn, CONN_REQUEST);                // next request arriving
+  }
+
+  while(conn.state != CONN_RESPOND) {
+    if(conn.next == conn.count) {                 // all used, read more
+      int n = min(conn.client.available(), HTTP_READ_CHUNK);
+      if(n > 0) n = conn.client.read((uint8_t *)conn.received, n);
+      if(n <= 0) break;
+      conn.next = 0;
+      conn.count = n;
+    }
+    httpChar(conn, conn.received[conn.next++]);
+  }
+
+  if(conn.state == CONN_RESPOND) {
+    LOG_D(" %s", conn.line);
+    BENCH(benchRequest());
+
+    if(conn.overflow) {
+      httpError(conn.client, "414 URI Too Long");
+    } else {
+      unsigned long start = micros();
+      httpRequest req;
+      httpParse(conn, req);
+      int route = parseLine(conn, req);           // functionality from the request line
+      metricsTime(metrics.route[route], micros() - start);
+    }
+    if(conn.state == CONN_EVENTS) return;         // event streams stay open
+    if(conn.keep) httpReset(conn, CONN_IDLE);
+    else httpClose(conn);
     return;
   }
 
-/*
-  //  Unfinished - load/store password in local flash
-  //
-  if(line.startsWith("GET /AP")) {            // Access point config            /AP?SSID=<value>&PASSWORD=<value>
-    int pos = 0;    
-    String ssid, password;
+  if(!conn.client.connected()
+  || millis() - conn.start > HTTP_TIMEOUT) {      // gone away or too slow
+    httpClose(conn);
+  }
+}
+
+//  Advance the connection state by one received char
+//
+void httpChar(httpConnection &conn, char c) {
+  if(c == '\r') return;                           // carriage return - ignored
+
+  switch(conn.state) {
+    case CONN_REQUEST:
+      if(c == '\n') {                             // end of the request line
+        conn.state = CONN_HEADERS;
+        break;
+      }
+      if(conn.length >= HTTP_LINE_SIZE -1) {      // bounded - remember we lost some
+        conn.overflow = true;
+        break;
+      }
+      conn.line[conn.length++] = c;
+      conn.line[conn.length] = '\0';
+      break;
+
+    case CONN_HEADERS:
+      if(c != '\n') {
+        if(conn.header < HTTP_HEADER_SIZE -1) conn.headerLine[conn.header] = c;
+        conn.header++;
+        break;
+      }
+      if(conn.header == 0) {                      // blank line - end of the request
+        conn.state = CONN_RESPOND;
+        break;
+      }
+      conn.headerLine[min(conn.header, HTTP_HEADER_SIZE -1)] = '\0';
+      httpHeaderLine(conn);
+      conn.header = 0;
+      break;
+  }
+}
+
+//  Interpret the header lines that change the response
+//
+void httpHeaderLine(httpConnection &conn) {
+  char *line = conn.headerLine;
+
+  if(strncasecmp(line, "If-None-Match:", 14) == 0
+  && strstr(line, DASHBOARD_ETAG) != 0) {
+    conn.flags |= REQ_ETAG_MATCH;
+  }
+
+  if(strncasecmp(line, "Connection:", 11) == 0) {
+    if(strcasestr(line, "close") != 0) conn.flags |= REQ_CLOSE;
+    if(strcasestr(line, "keep-alive") != 0) conn.flags |= REQ_KEEPALIVE;
+  }
+
+  if(strncasecmp(line, "Host:", 5) == 0) {
+    char *host = line + 5;
+    while(*host == ' ') host++;
+    if(!isdigit(*host) && *host != '[') conn.flags |= REQ_HOST_NAME;   // not IPv4/IPv6
+  }
+}
 
-    if(nextName(line, pos) == "ssid") {
-      ssid = nextValue(line, pos);
+//  Disconnect and free the slot
+//
+void httpClose(httpConnection &conn) {
+  conn.client.stop();
+  conn.state = CONN_FREE;
+
+  LOG_D("client disconnected");
+}
+
+//  Split the request line in place, in one pass
+//  "GET /R?lease=60&address=33057.2 HTTP/1.1" => method GET, path /R, params lease=60 address=33057.2
+//  Nothing is copied, the spaces, ? and & are overwritten with \0
+//
+void httpParse(httpConnection &conn, httpRequest &req) {
+  char *p = conn.line;
+  req.method = p;
+  req.aliases = "";
+  req.params = 0;
+
+  while(*p != '\0' && *p != ' ') p++;             // method
+  if(*p == ' ') *p++ = '\0';
+
+  req.path = p;                                   // path
+  while(*p != '\0' && *p != ' ' && *p != '?') p++;
+
+  if(*p == '?') {                                 // query, name=value pairs
+    *p++ = '\0';
+    while(*p != '\0' && *p != ' ') {
+      if(*p != '&' && req.params < HTTP_PARAMS) req.param[req.params++] = p;
+      while(*p != '\0' && *p != ' ' && *p != '&') p++;
+      if(*p == '&') *p++ = '\0';
     }
-    if(nextName(line, pos) == "password") {
-      password = nextValue(line, pos);
+  }
+  req.end = p;
+
+  if(*p == ' ') {                                 // version
+    *p++ = '\0';
+    if(strcmp(p, "HTTP/1.0") == 0) conn.flags |= REQ_HTTP10;
+  }
+}
+
+//  Value of a query parameter by name or its alias, "" for a name alone e.g. /S?all
+//  Returns 0 if it wasn't passed
+//
+const char *httpParam(httpRequest &req, const char *name) {
+  int l = strlen(name);
+  char alias = httpAlias(req, name, l);
+  for(int n = 0; n < req.params; n++) {
+    const char *p = req.param[n];
+    int k = strncmp(p, name, l) == 0 ? l
+          : alias != '\0' && p[0] == alias ? 1 : 0;    // matched length
+    if(k == 0) continue;
+    if(p[k] == '=') return p + k +1;
+    if(p[k] == '\0') return p + k;
+  }
+  return 0;
+}
+
+//  The single letter alias for a parameter name on the request's route, '\0' if none
+//  Aliases are "<letter>:<name>" separated by spaces
+//
+char httpAlias(httpRequest &req, const char *name, int length) {
+  for(const char *a = req.aliases; *a != '\0'; ) {
+    const char *end = a + 2;
+    while(*end != '\0' && *end != ' ') end++;
+    if(end - (a + 2) == length && strncmp(a + 2, name, length) == 0) return a[0];
+    a = *end == ' ' ? end +1 : end;
+  }
+  return '\0';
+}
+
+//  Numeric value of a query parameter, otherwise if it wasn't passed
+//
+unsigned long httpNumber(httpRequest &req, const char *name, unsigned long otherwise) {
+  const char *value = httpParam(req, name);
+  return value == 0 ? otherwise : strtoul(value, 0, 10);
+}
+
+//  Step through an address list "33057.2,33035@60s,2:33139"
+//  Returns false at the end, otherwise the next address with list moved past it
+//
+bool nextAddress(const char *&list, int &address, int &size, unsigned long &interval) {
+  if(list == 0) return false;
+  while(*list == ',') list++;                     // empty entries
+  if(*list == '\0') return false;
+
+  address = parseAddress(list, size, interval, &list);
+  while(*list != '\0' && *list != ',') list++;    // anything not understood
+  if(*list == ',') list++;
+  return true;
+}
+
+//  True if every address in the list is in range
+//
+bool validAddresses(const char *list) {
+  int address, size;
+  unsigned long interval;
+  while(nextAddress(list, address, size, interval)) {
+    if(address == ADDRESS_INVALID) return false;
+  }
+  return true;
+}
+
+//  Paths answered and their responses, matched exactly
+//  With the single letter parameters older clients use, e.g. the Shelly SOC script's /R?a=33139,33057.2
+//
+const httpRoute httpRoutes[] = {
+  {"/",           "",                                           routeDashboard},
+  {"/dashboard",  "",                                           routeDashboard},
+  {"/R",          "a:address r:refresh s:since l:lease",        routeValues},
+  {"/B",          "a:address l:lease",                          routeBinary},
+  {"/events",     "a:address",                                  routeEvents},
+  {"/H",          "a:address m:minutes h:hours d:days k:keep",  routeHistory},
+  {"/Q",          "a:address r:range c:count",                  routeQuery},
+  {"/P",          "a:address",                                  routePin},
+  {"/S",          "a:address",                                  routeStop},
+  {"/V",          "a:address e:expr",                           routeVirtual},
+  {"/C",          "",                                           routeCache},
+  {"/metrics",    "",                                           routeMetrics},
+  {"/log",        "",                                           routeLog},
+  {"/L",          "",                                           routeLed},
+};
+#define HTTP_ROUTES (sizeof(httpRoutes) / sizeof(httpRoutes[0]))
+static_assert(METRIC_ROUTES == HTTP_ROUTES +1, "METRIC_ROUTES must be the httpRoutes entries plus one");
+
+//  Respond to a request by its path
+//  Out of range addresses are refused with 400 before any route builds a key from them
+//  Fallthrough - send a confirmation header/footer anyway so the caller knows I'm here
+//  Returns the httpRoutes index that responded, HTTP_ROUTES for none
+//
+int parseLine(httpConnection &conn, httpRequest &req) {
+  for(unsigned int r = 0; r < HTTP_ROUTES; r++) {
+    if(strcmp(req.path, httpRoutes[r].path) == 0) {
+      req.aliases = httpRoutes[r].aliases;
+      if(validAddresses(httpParam(req, "address"))) httpRoutes[r].handler(conn, req);
+      else httpError(conn.client, "400 Bad Request");
+      return r;
     }
+  }
+  httpEmpty(conn);
+  return HTTP_ROUTES;
+}
 
-    // save ssid/password to flash here
-    httpHeader(client);
-    client.println(F("SSID, Password set - reset to retry Wifi connection"));
-    httpFooter(client);
-    return;
+//  Historic entry points - useful for basic testing
+//  /H alone turns the LED on, with parameters it's history collection
+//
+void routeLed(httpConnection &conn, httpRequest &req) {
+  bool on = req.path[1] == 'H';
+  digitalWrite(LED_BUILTIN, on ? HIGH : LOW);
+  httpHeader(conn.client);
+  conn.client.print(on ? F("LED on") : F("LED off"));
+  httpFooter(conn.client);
+}
+
+//  The dashboard is stored gzip compressed, sent as is for the browser to expand
+//  Browsers keep it and revalidate with the ETag, unchanged gets an empty 304 response
+//  Requested by name (mDNS) the browser is redirected to the IP address, call backs on the name alone were unstable
+//
+void routeDashboard(httpConnection &conn, httpRequest &req) {    // /dashboard?server=<value>
+  HttpWriter out(conn.client);
+
+  if(conn.flags & REQ_HOST_NAME) {
+    out.print(F("HTTP/1.1 302 Found\r\nLocation: http://"));
+    out.print(WiFi.localIP());
+    out.print(F("/dashboard\r\n"));
+
+  } else if(conn.flags & REQ_ETAG_MATCH) {
+    out.print(F("HTTP/1.1 304 Not Modified\r\n"));
+
+  } else {
+    out.print(F("HTTP/1.1 200 OK\r\n"
+                "Content-Type: text/html\r\n"
+                "Content-Encoding: gzip\r\n"
+                "Content-Length: "));
+    out.writeLong(sizeof(dashboardGz));
+    out.print(F("\r\n"));
   }
+  conn.keep = httpKeep(conn);
+  if(conn.flags & (REQ_HOST_NAME | REQ_ETAG_MATCH)) out.print(F("Content-Length: 0\r\n"));
+  out.print(F("ETag: " DASHBOARD_ETAG "\r\n"
+              "Cache-Control: no-cache\r\n"));
+  out.print(conn.keep ? F("Connection: keep-alive\r\n\r\n") : F("Connection: close\r\n\r\n"));
+
+  if(!(conn.flags & (REQ_HOST_NAME | REQ_ETAG_MATCH))) {
+    out.write(dashboardGz, sizeof(dashboardGz));
+  }
+  out.flush();
+}
+
+//  Push register value changes       /events?address=<address>,<address>...
+//
+void routeEvents(httpConnection &conn, httpRequest &req) {
+  const char *list = httpParam(req, "address");
+  if(list == 0) httpEmpty(conn);
+  else eventsSubscribe(conn, list);
+}
+
+/*
+//  Unfinished - load/store password in local flash
+//  Access point config              /AP?ssid=<value>&password=<value>
+//
+void routeAccessPoint(httpConnection &conn, httpRequest &req) {
+  const char *ssid = httpParam(req, "ssid");
+  const char *password = httpParam(req, "password");
+
+  // save ssid/password to flash here
+  httpHeader(conn.client);
+  conn.client.println(F("SSID, Password set - reset to retry Wifi connection"));
+  httpFooter(conn.client);
+}
 */
 
-  if(strstr(line, "GET /R") != 0) {           // Return register values           /R?refresh=<seconds>&address=<address>,<address>...
-    char *pos = nextName(line, name);
-    
-    int refresh = 0;                          // ?refresh=n  parameter must come first for the header
-    if(name[0] == 'r') {
-      pos = nextValue(pos, value);      
-      refresh = atoi(value);
-      pos = nextName(pos, name);
+//  Return register values           /R?refresh=<seconds>&since=<seq>&lease=<seconds>&age=1&address=<address>[@<interval>],<address>...
+//
+void routeValues(httpConnection &conn, httpRequest &req) {
+  HttpWriter out(conn.client);
+  httpBegin(conn, out, httpNumber(req, "refresh"));           // ?refresh=n  automatic page refresh
+
+  const char *since = httpParam(req, "since");                // ?since=<seq> only values changed after seq
+  unsigned long lease = httpNumber(req, "lease") * 1000;      // ?lease=<seconds> keep the addresses without asking again
+  bool age = httpNumber(req, "age") != 0;                     // ?age=1 how old each value is, never remembered
+  const char *list = httpParam(req, "address");               // ?address=<value>,<value>...
+
+  if(list != 0) {
+    unsigned long hash = memoHash(req);
+    if(age || !memoReply(hash, lease, out)) {                 // same request, same values - send it again
+      if(!age) out.capture(memoStart(hash));
+      if(since != 0) parseAddressChanges(list, strtoul(since, 0, 10), lease, out);
+      else parseAddressValues(list, "data", lease, age, out);
     }
-    httpHeader(client, refresh);
-        
-    if(name[0] == 'a') {                      // ?address=<value>,<value>...
-      pos = parseAddressValues(pos, "data",  json);
-      client.print(json);
+  }
+  out.end();
+  memoEnd();
+}
+
+//  Virtual registers                 /V?address=<address>&expr=<expression>
+//
+void routeVirtual(httpConnection &conn, httpRequest &req) {
+  if(httpParam(req, "address") != 0) {
+    int address = httpNumber(req, "address");
+    const char *expr = httpParam(req, "expr");                // the expression has commas, to the end of the parameter
+    if(address == 0 || !virtualDefine(address, expr == 0 ? "" : expr)) {
+      httpError(conn.client, "400 Bad Request");
+      return;
     }
-    httpFooter(client);
+    storeVirtual(address);
+  }
+
+  HttpWriter out(conn.client);
+  httpBegin(conn, out);
+  virtualJSON(out);
+  out.end();
+}
+
+//  Prometheus text format counters
+//
+void routeMetrics(httpConnection &conn, httpRequest &req) {
+  HttpWriter out(conn.client);
+  httpBegin(conn, out, 0, "text/plain; version=0.0.4");
+  metricsWrite(out);
+  out.end();
+}
+
+//  Recent log lines, oldest first
+//
+void routeLog(httpConnection &conn, httpRequest &req) {
+  HttpWriter out(conn.client);
+  httpBegin(conn, out, 0, "text/plain");
+  logText(out);
+  out.end();
+}
+
+//  Binary register values           /B?lease=<seconds>&address=<address>[@<interval>],<address>...
+//
+void routeBinary(httpConnection &conn, httpRequest &req) {
+  const char *list = httpParam(req, "address");
+  if(list == 0) {
+    httpEmpty(conn);
     return;
   }
+  HttpWriter out(conn.client);
+  httpBegin(conn, out, 0, "application/octet-stream");
+  parseAddressBinary(list, httpNumber(req, "lease") * 1000, out);
+  out.end();
+}
 
-  if(strstr(line, "GET /H") != 0) {           // Setup historic data collection   /H?minutes=<m/h/d>&keep=<d>&address=<address>...
-    char *pos = nextName(line, name);
-    char range = 'h';
-    int freq = 1, keep = 1, address;
+//  Setup historic data collection   /H?minutes=<m/h/d>&keep=<d>&address=<address>...
+//
+void routeHistory(httpConnection &conn, httpRequest &req) {
+  if(req.params == 0) {
+    routeLed(conn, req);
+    return;
+  }
 
-    if(name[0] == 'm'
-    || name[0] == 'h' 
-    || name[0] == 'd') {                      // # minutes, hours, days collection frequency
-      pos = nextValue(pos, value);
-      range = name[0];
-      freq = atoi(value);
-      pos = nextName(pos, name);
-    }
-    if(name[0] == 'k') {                      // # days to keep
-      pos = nextValue(pos, value);
-      keep = atoi(value);
-      pos = nextName(pos, name);
-    }
-    if(name[0] == 'a') {                            // address values to collect
-      pos = nextValue(pos, value);                  // First value
-      while(value[0] != '\0') {                     // process all values requested
-        address = atoi(value);
-        keepHistory(range, freq, keep, address);    // instruct the history routines
-        pos = nextValue(pos, value);                // next value
-      }
-    }
+  char range = 'h';                               // # minutes, hours, days collection frequency
+  int freq = 1;
+  const char *const ranges[] = {"minutes", "hours", "days"};
+  for(int r = 0; r < 3; r++) {
+    if(httpParam(req, ranges[r]) == 0) continue;
+    range = ranges[r][0];
+    freq = httpNumber(req, ranges[r]);
+  }
+  int keep = httpNumber(req, "keep", 1);          // # days to keep
+
+  const char *list = httpParam(req, "address");   // address values to collect
+  int address, size;
+  unsigned long interval;
+  while(nextAddress(list, address, size, interval)) {
+    registerInterval(registerIndex(address, size), interval);
+    if(registerDevice(address) == MODBUS_DEVICE) keepHistory(range, freq, keep, address);   // inverter only, stored as 16 bit addresses
+  }
+  httpEmpty(conn);
+}
 
-    
-    httpHeader(client);
-    httpFooter(client);
-    return;    
+//  Query historic data              /Q?range=<m/h/d>&count=<n>&address=<address>
+//
+void routeQuery(httpConnection &conn, httpRequest &req) {
+  const char *range = httpParam(req, "range");    // m 5 minute, h hourly, d daily
+  int count = httpNumber(req, "count");           // newest n points only
+
+  HttpWriter out(conn.client);
+  httpBegin(conn, out);
+  const char *list = httpParam(req, "address");
+  int address, size;
+  unsigned long interval;
+  if(nextAddress(list, address, size, interval)) {
+    historyJSON(address, range == 0 ? 'm' : range[0], count, out);
   }
-  
-  if(strstr(line, "GET /S") != 0) {           // Stop collecting register values  /S?address=<address>
-    char *pos = nextName(line, name);
-    
-    if(strcmp(name, "all") == 0) {                        // /S?all
-      stopAll();
+  out.end();
+}
+
+//  Stop collecting register values  /S?address=<address>  /S?all
+//
+void routeStop(httpConnection &conn, httpRequest &req) {
+  const char *list = httpParam(req, "address");
+  int address, size;
+  unsigned long interval;
 
-    } else if(strcmp(name, "address") == 0) {             // /S?address=<address>
-      pos = nextValue(pos, value);
-      stopRegister(atoi(value));
+  if(httpParam(req, "all") != 0) {
+    stopAll();
+
+  } else if(nextAddress(list, address, size, interval)) {
+    stopRegister(address);
+  }
+  httpEmpty(conn);
+}
 
+//  Pin registers, kept until stopped  /P?address=<address>,<address>...
+//
+void routePin(httpConnection &conn, httpRequest &req) {
+  const char *list = httpParam(req, "address");
+  int address, size;
+  unsigned long interval;
+  while(nextAddress(list, address, size, interval)) {
+    int i = registerIndex(address, size);
+    if(i == -1) {
+      httpError(conn.client, "503 Service Unavailable");
+      return;
     }
-    httpHeader(client);
-    httpFooter(client);
-    return;
+    cacheTouch(i);
+    registerInterval(i, interval);
+    registerPin(i);
   }
+  httpEmpty(conn);
+}
 
-  if(strstr(line, "GET /C") != 0) {          // Readout the cache
-    httpHeader(client);
-    client.print(F("Register cache<br>"));
-    for(int i = 0; i < CACHE_SIZE; i++) {
-      client.print("[");
-      client.print(i);
-      client.print("] (");
-      client.print(regCache[i].state);
-      client.print(") @");
-      client.print(regCache[i].age);
-      client.print(" ");
-      client.print(regCache[i].address);
-      client.print(".");
-      client.print(regCache[i].size);
-      client.print(" = ");
-      client.print(regCache[i].value);
-      client.print("<br>");
+//  Readout the cache
+//
+void routeCache(httpConnection &conn, httpRequest &req) {
+  WiFiClient &client = conn.client;
+  httpHeader(client);
+  client.print(F("Register cache<br>"));
+  for(int i = 0; i < CACHE_SIZE; i++) {
+    client.print("[");
+    client.print(i);
+    client.print("] (");
+    client.print(regCache[i].state);
+    client.print(") @");
+    client.print(regCache[i].age);
+    client.print(" ");
+    printRegister(client, regCache[i].address);
+    client.print(".");
+    client.print(regCache[i].size);
+    client.print(" = ");
+    client.print(regCache[i].value);
+    client.print(" every ");
+    client.print(regCache[i].interval);
+    client.print((regCache[i].flags & REG_INTERVAL) ? "ms" : "ms learned");
+    if(regCache[i].failures > 0) {
+      client.print(" failed ");
+      client.print(regCache[i].failures);
+      client.print(" retry in ");
+      client.print((long)(regCache[i].due - millis()));
+      client.print("ms");
     }
+    if(regCache[i].flags & REG_SOLO) client.print(" solo");
+    if(regCache[i].flags & REG_VIRTUAL) client.print(" virtual");
+    if(regCache[i].address != 0) client.print(regCache[i].queue == CACHE_PROTECTED ? " protected" : " probation");
+    if(regCache[i].flags & REG_PIN) client.print(" pinned");
+    if((long)(regCache[i].lease - millis()) > 0) {
+      client.print(" leased ");
+      client.print((regCache[i].lease - millis()) / 1000);
+      client.print("s");
+    }
+    client.print("<br>");
+  }
+  for(int d = 0; d < BUS_DEVICES; d++) {
+    busDevice &dev = busDevices[d];
+    if(dev.id == 0) continue;
+    client.print(F("Modbus device "));
+    client.print(dev.id);
+    client.print(F(" bus time "));
+    client.print(dev.used);
+    client.print("ms");
+    if(dev.probe != 0) {
+      client.print(F(" breaker open, probe every "));
+      client.print(dev.probe);
+      client.print("ms");
+    }
+    client.print("<br>");
+  }
 
-    client.print(F("History cache<br>"));
-    httpFooter(client);
-    return;
+  client.print(F("Snapshot cycle "));
+  client.print(snapshot.cycle);
+  client.print(F(", "));
+  client.print(millis() - snapshot.taken);
+  client.print(F("ms ago<br><br>"));
+
+  client.print(F("Rules<br>"));
+  for(unsigned int r = 0; r < RULE_COUNT; r++) {
+    client.print(ruleTable[r].name);
+    client.print(rules[r].state == RULE_ON ? " on" : rules[r].state == RULE_OFF ? " off" : " unknown");
+    if(rules[r].pending) client.print(" sending");
+    client.print("<br>");
   }
 
-  //  Fallthrough - send a confirmation header/footer anyway so the caller knows I'm here
-  //
-  httpHeader(client);
+  client.print(F("History cache<br>"));
+  for(int h = 0; h < HISTORY_CACHE_SIZE; h++) {
+    if(histCache[h].address == 0) continue;
+    client.print(histCache[h].address);
+    for(int t = 0; t < HISTORY_TIERS; t++) {
+      if(!histCache[h].keep[t]) continue;
+      client.print(" ");
+      client.print(historyRange[t]);
+      client.print("=");
+      client.print(histCache[h].tier[t].points);
+      client.print("/");
+      client.print(histCache[h].tier[t].used);
+      client.print("b");
+    }
+    client.print("<br>");
+  }
   httpFooter(client);
-  
+}
+
+//  Start a framed response, kept alive if the client wants it and there is room
+//
+void httpBegin(httpConnection &conn, HttpWriter &out, int refresh, const char *type) {
+  conn.keep = httpKeep(conn);
+  out.frame(type, refresh, conn.keep, conn.flags & REQ_HTTP10);
+}
+
+//  Send an empty framed response
+//
+void httpEmpty(httpConnection &conn) {
+  HttpWriter out(conn.client);
+  httpBegin(conn, out);
+  out.end();
+}
+
+//  True if the connection can stay open after this response
+//  HTTP/1.1 unless Connection: close, HTTP/1.0 only with Connection: keep-alive
+//
+bool httpKeep(httpConnection &conn) {
+  bool wanted = (conn.flags & REQ_HTTP10) ? (conn.flags & REQ_KEEPALIVE) : !(conn.flags & REQ_CLOSE);
+  if(!wanted) return false;
+
+  int idle = 0;
+  for(int c = 0; c < HTTP_CONNECTIONS; c++) {
+    if(connections[c].state == CONN_IDLE) idle++;
+  }
+  return idle < HTTP_KEEPALIVE;
 }
 
 //  Send the standard HTTP header
@@ -263,6 +694,16 @@ void httpHeader(WiFiClient client, int refresh) {
     client.println();
 }
 
+//  Send an error status with no content
+//
+void httpError(WiFiClient client, const char *status) {
+    client.print("HTTP/1.1 ");
+    client.println(status);
+    client.println("Connection: close");
+    client.println("Access-Control-Allow-Origin: *");
+    client.println();
+}
+
 //  Standard close out a request with an empty line
 //
 void httpFooter(WiFiClient client) {
@@ -283,82 +724,166 @@ void httpPrint(WiFiClient client, const char *data, int length) {
     client.write(p, length);                  // partial left over
 }
 
-//  Next name "..... ?<name>=...&<name> ...."
-//  name is updated with the name
-//  returns a pointer to the next char
+//  Interpret an address value [<device>:]<address>[.<size>][@<interval>[s|ms]]
+//  e.g. 33057.2@2s  33035@60s  33139@500ms  2:33057.2
+//  Returns the register key, size 1 or 2 and the interval in ms or 0 if none
+//  ADDRESS_INVALID for a device outside 1..247 or an address outside 0..0xFFFF, checked before the key is built
+//  next, if passed, is set to the char after the number read last
 //
-char *nextName(char *line, char *name) {
-  return nextStr(line, "?&", "= ", name);    
-}
+int parseAddress(const char *value, int &size, unsigned long &interval, const char **next) {
+  char *end;
+  long device = MODBUS_DEVICE;
+  long number = strtol(value, &end, 10);
+  if(*end == ':') {
+    device = number;
+    number = strtol(end +1, &end, 10);
+  }
+  int address = device < 1 || device > 247 || number < 0 || number > 0xFFFF ? ADDRESS_INVALID : registerKey(device, number);
 
+  size = 1;
+  if(*end == '.') size = strtol(end +1, &end, 10) == 2 ? 2 : 1;
 
-//  Next value "..... =<value>,<value>&<parm>=... "
-//  value is updated with the value
-//  returns a pointer to the next char
-//
-char *nextValue(char *line, char *value) {
-  return nextStr(line, "=,", ",&? ", value);  
+  interval = 0;
+  if(*end == '@') {
+    interval = strtoul(end +1, &end, 10);
+    if(strncmp(end, "ms", 2) != 0) interval *= 1000;    // seconds unless ms
+  }
+  if(next != 0) *next = end;
+  return address;
 }
 
-//  Find the next string delimited by d1, d2 in line
-//  Value is the found value
-//  Returns a pointer to the char after the value
-//  
-char *nextStr(char *line, const char *d1, const char *d2, char *value) {
-  value[0] = '\0';
-  char *start = strpbrk(line, d1);
-  char *end = strpbrk(start +1, d2);
+//  Parse the passed address list
+//  Address values are added to the lookup cache and their values in the last Snapshot streamed out as a JSON array
+//  Addresses refused with the cache full are null, with an error after the array
+//  With age, ms since each value was read from the inverter as a second array, null for no data
+//
+//  {"cycle":57,"data":[1, 100, 262, -144, 12, 417, 173, 43, 55]}
+//  {"cycle":57,"data":[1, 100, null],"error":"cache full"}
+//  {"cycle":57,"data":[1, 100, 262],"age":[830, 2150, null]}
+//
+void parseAddressValues(const char *list, const char *label, unsigned long lease, bool age, HttpWriter &out) {
+  out.print(F("{\"cycle\":"));               // {"cycle":n,"label":[
+  out.print(snapshot.cycle);
+  out.print(",\"");
+  out.print(label);
+  out.print("\":[");
+
+  //  Loop around each parameter value writing the json array
+  //
+  bool full = false;
+  int address, size;                          // interpret optional <address>.1 or .2 @<interval>
+  unsigned long interval;
+  const char *p = list;
+  for(int n = 0; nextAddress(p, address, size, interval); n++) {   // process all values requested
+    if(n > 0) out.write(',');
+    getRegister(address, size);               // keep it collected
+    int i = cacheFind(address);
+    memoIndex(i);
+    if(i == -1) {
+      out.print("null");
+      full = true;
+    } else {
+      snapshotValue *s = snapshotFind(address);
+      out.writeLong(s == 0 ? 0 : s->value);
+    }
+    registerInterval(i, interval);
+    registerLease(i, lease);
+  }
+  out.write(']');
+
+  if(age) {                                   // ,"age":[
+    out.print(F(",\"age\":["));
+    unsigned long now = millis();
+    p = list;
+    for(int n = 0; nextAddress(p, address, size, interval); n++) {
+      snapshotValue *s = snapshotFind(address);
+      if(n > 0) out.write(',');
+      if(s == 0 || s->state == STATE_NULL) out.print("null");
+      else out.writeLong(now - s->sampled);
+    }
+    out.write(']');
+  }
 
-  if(!start || !end) return line;             // no delimiter pair
+  out.print(full ? ",\"error\":\"cache full\"}" : "}");
+}
 
-  int l = end - start -1;
-  strncpy(value, start +1, l);                // copy it into the value parm
-  value[l] = '\0';                            // strncpy doesnt append \0
-  
-//  Serial.print("nextStr: ");
-//  Serial.println(value);
+//  Parse the passed address list
+//  As parseAddressValues with the response in a fixed binary layout for machine clients, little endian
+//    uint32  sequence                  snapshot sequence, as /R?since
+//    uint32  age                       ms since the oldest of the values was read from the inverter
+//    uint16  count                     addresses following, in request order
+//    count x int32 value, uint8 state  STATE_NULL 0, STATE_VALID 1, STATE_ERROR 2, STATE_FULL 3
+//
+void parseAddressBinary(const char *list, unsigned long lease, HttpWriter &out) {
+  int address, size;
+  unsigned long interval;
+
+  int count = 0;                              // count and age first
+  unsigned long now = millis(), age = 0;
+  for(const char *p = list; nextAddress(p, address, size, interval); ) {
+    snapshotValue *s = snapshotFind(address);
+    if(s != 0 && s->state != STATE_NULL && now - s->sampled > age) age = now - s->sampled;
+    count++;
+  }
 
-  return end;
+  writeBinary(out, snapshot.sequence, 4);
+  writeBinary(out, age, 4);
+  writeBinary(out, count, 2);
+
+  for(const char *p = list; nextAddress(p, address, size, interval); ) {
+    int i = registerIndex(address, size);     // resolved once, keep it collected
+    cacheTouch(i);
+    registerInterval(i, interval);
+    registerLease(i, lease);
+    snapshotValue *s = snapshotFind(address);
+    writeBinary(out, s == 0 ? 0 : s->value, 4);
+    out.write(i == -1 ? STATE_FULL : s == 0 ? STATE_NULL : s->state);
+  }
 }
 
+//  Write a little endian value
+//
+void writeBinary(HttpWriter &out, unsigned long value, int bytes) {
+  for(int b = 0; b < bytes; b++) {
+    out.write((byte)value);
+    value >>= 8;
+  }
+}
 
-//  Parse the passed paramter line
-//  Address values are added to the lookup cache and returned as a JSON array
-//  Returns the pointer after the last one
+//  Parse the passed address list
+//  As parseAddressValues but only addresses changed after the since sequence are returned,
+//  by address with null for no data, along with the sequence to pass as since next time
+//  Addresses refused with the cache full are always null, with an error after the data
 //
-//  {"data":[1, 100, 262, -144, 12, 417, 173, 43, 55]}
+//  {"cycle":57,"seq":1234,"data":{"33057":262,"33070":null}}
 //
-char *parseAddressValues(char *line, const char *label, char *json) {
-  char valueS[50], regS[10];
-
-  //  Loop around each parameter value building the json array
-  //
-  json[0] = '\0';
-  strcat(json, "{\"");                        // {"label":[
-  strcat(json, label);
-  strcat(json, "\":[");
-  
-  char *pos = nextValue(line, valueS);        // First value
-  while(valueS[0] != '\0') {                  // process all values requested
-
-    int address = atoi(valueS);
-    int size = 1;                             // interpret optional <address>.1 or .2    
-    if(strstr(valueS, ".2")) size = 2;
-
-    long reg = getRegister(address, size);
-    itoa(reg, regS, 10);                      // base10 string
-    strcat(json, regS);                       // value,
-    strcat(json, ",");
-
-    pos = nextValue(pos, valueS);             // Next value
+void parseAddressChanges(const char *list, unsigned long since, unsigned long lease, HttpWriter &out) {
+  out.print(F("{\"cycle\":"));
+  out.print(snapshot.cycle);
+  out.print(F(",\"seq\":"));
+  out.print(snapshot.sequence);
+  out.print(F(",\"data\":{"));
+
+  bool full = false;
+  int address, size;                          // interpret optional <address>.1 or .2 @<interval>
+  unsigned long interval;
+  for(int n = 0; nextAddress(list, address, size, interval); ) {   // process all values requested
+    getRegister(address, size);               // keep it collected
+    int i = cacheFind(address);
+    memoIndex(i);
+    registerInterval(i, interval);
+    registerLease(i, lease);
+    if(i == -1) full = true;
+    snapshotValue *s = snapshotFind(address);
+    if(i == -1 || (s != 0 && s->version > since)) { // changed - "address":value
+      if(n++ > 0) out.write(',');
+      out.write('"');
+      printRegister(out, address);
+      out.print("\":");
+      if(s != 0 && s->state == STATE_VALID) out.writeLong(s->value);
+      else out.print("null");
+    }
   }
 
-  //  Adjust the tail
-  //
-  int i = strlen(json) -1;
-  json[i++] = ']';                              // last , to ]}
-  json[i++] = '}';
-  json[i] = '\0';                           
-  
-  return pos;
+  out.print(full ? "},\"error\":\"cache full\"}" : "}}");
 }
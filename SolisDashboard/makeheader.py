@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+#
+#   makeheader.py
+#   https://github.com/RichardL64
+#
+#   Generate SolisComms/SolisDashboard.html.h from SolisDashboard.html
+#   The page is stored gzip compressed, served as is with Content-Encoding: gzip
+#   The ETag is the CRC32 of the page so browsers revalidate to 304 Not Modified until it changes
+#
+#   Run after any change to the dashboard:
+#     python3 SolisDashboard/makeheader.py
+#
+#   R.A.Lincoln       July 2022
+#
+import gzip, os, zlib
+
+here = os.path.dirname(os.path.abspath(__file__))
+source = os.path.join(here, 'SolisDashboard.html')
+target = os.path.join(here, '..', 'SolisComms', 'SolisDashboard.html.h')
+
+html = open(source, 'rb').read()
+gz = gzip.compress(html, compresslevel=9, mtime=0)       # fixed mtime - same page, same bytes
+etag = '%08x' % zlib.crc32(html)
+
+with open(target, 'w') as h:
+    h.write('''/*
+
+    SolisDashboard.html.h
+    https://github.com/RichardL64
+
+    Simple real time Solis Inverter dashboard
+
+    Generated by SolisDashboard/makeheader.py from SolisDashboard/SolisDashboard.html - do not edit
+    %d bytes gzip compressed from %d
+
+    R.A.Lincoln       July 2022
+
+*/
+#define DASHBOARD_ETAG "\\"%s\\""
+
+const unsigned char dashboardGz[] = {
+''' % (len(gz), len(html), etag))
+    for i in range(0, len(gz), 16):
+        h.write('  ' + ' '.join('0x%02x,' % b for b in gz[i:i + 16]) + '\n')
+    h.write('};\n')
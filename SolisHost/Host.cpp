@@ -0,0 +1,75 @@
+/*
+
+    Host
+    https://github.com/RichardL64
+
+    The Arduino core and library objects the stand in headers declare
+    Time is the host's monotonic clock from startup, so modbus timing and the benchmarks are real
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include <ArduinoRS485.h>
+#include <time.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+RS485Class RS485;
+WiFiClass WiFi;
+WiFiStorageClass WiFiStorage;
+hostSocket hostSockets[HOST_SOCKETS];
+int hostWiFiStatus = WL_IDLE_STATUS;
+hostGclk hostGclkRegisters;
+hostWdt hostWdtRegisters;
+
+#define HOST_WRAP 15000                       // ms from start to the millis() wrap
+
+//  us since the first call
+//  millis and micros start HOST_WRAP ms short of their 32 bit wrap, so every check run crosses it
+//
+static unsigned long long hostClock() {
+  static unsigned long long start;
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  unsigned long long us = now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+  if(start == 0) start = us;
+  return us - start;
+}
+
+uint32_t millis() {
+  return hostClock() / 1000 - HOST_WRAP;
+}
+
+uint32_t micros() {
+  return hostClock() - HOST_WRAP * 1000;
+}
+
+void delay(uint32_t ms) {
+  usleep(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  usleep(us);
+}
+
+void pinMode(int pin, int mode) {}
+void digitalWrite(int pin, int value) {}
+
+int analogRead(int pin) {
+  return 0;
+}
+
+int32_t random(int32_t high) {
+  return high <= 0 ? 0 : rand() % high;
+}
+
+int32_t random(int32_t low, int32_t high) {
+  return low + random(high - low);
+}
+
+void randomSeed(uint32_t seed) {
+  srand(seed);
+}
@@ -0,0 +1,178 @@
+/*
+
+    Arduino.h
+    https://github.com/RichardL64
+
+    Host stand in for the Arduino core, just what SolisComms uses
+    SAMD21 sizes where it matters - char unsigned (-funsigned-char), 32 bit times, F() strings in RAM
+    The sketch's own long is made 32 bits by Long32.h
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define LED_BUILTIN 13
+#define DEC 10
+#define HEX 16
+#define PI 3.1415926535897932384626433832795
+#define PROGMEM
+#define F(s) (s)
+
+uint32_t millis();                            // 32 bit as the board's, wrap after 49 days
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int analogRead(int pin);
+int32_t random(int32_t high);
+int32_t random(int32_t low, int32_t high);
+void randomSeed(uint32_t seed);
+
+template<class T> T min(T a, T b) { return a < b ? a : b; }
+template<class T> T max(T a, T b) { return a > b ? a : b; }
+template<class T> T constrain(T x, T low, T high) { return x < low ? low : x > high ? high : x; }
+
+//  Enough of String for the firmware version check
+//
+class String {
+  public:
+    String() {}
+    String(const char *s) : s(s) {}
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool operator<(const char *other) const { return s < other; }
+  private:
+    std::string s;
+};
+
+class Print;
+
+class Printable {
+  public:
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+  public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *data, size_t size) {
+      size_t n = 0;
+      while(size--) n += write(*data++);
+      return n;
+    }
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t write(const char *data, size_t size) { return write((const uint8_t *)data, size); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(long n, int base = DEC) { return number(base == HEX ? "%lx" : "%ld", n); }
+    size_t print(unsigned long n, int base = DEC) { return number(base == HEX ? "%lx" : "%lu", n); }
+    size_t print(double d, int digits = 2) {
+      char text[32];
+      snprintf(text, sizeof(text), "%.*f", digits, d);
+      return write(text);
+    }
+    size_t print(const Printable &p) { return p.printTo(*this); }
+
+    size_t println() { return write("\r\n"); }
+    template<class T> size_t println(T value) { return print(value) + println(); }
+    template<class T> size_t println(T value, int base) { return print(value, base) + println(); }
+
+  private:
+    template<class T> size_t number(const char *format, T n) {
+      char text[24];
+      snprintf(text, sizeof(text), format, n);
+      return write(text);
+    }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+//  Serial to stdout, never full
+//
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long baud) {}
+    size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+    int availableForWrite() { return 4096; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    operator bool() { return true; }
+};
+extern HardwareSerial Serial;
+
+class IPAddress : public Printable {
+  public:
+    IPAddress() { memset(b, 0, 4); }
+    IPAddress(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3) { b[0] = b0; b[1] = b1; b[2] = b2; b[3] = b3; }
+    IPAddress(uint32_t address) { memcpy(b, &address, 4); }
+    operator uint32_t() const { uint32_t address; memcpy(&address, b, 4); return address; }
+    uint8_t operator[](int i) const { return b[i]; }
+    bool operator==(const IPAddress &other) const { return memcmp(b, other.b, 4) == 0; }
+    bool operator!=(const IPAddress &other) const { return !(*this == other); }
+    size_t printTo(Print &p) const {
+      char text[16];
+      snprintf(text, sizeof(text), "%d.%d.%d.%d", b[0], b[1], b[2], b[3]);
+      return p.write(text);
+    }
+  private:
+    uint8_t b[4];
+};
+
+//  SAMD21 clock and watchdog registers, written by Network and otherwise ignored
+//
+struct hostRegister {
+    uint32_t reg;
+    struct { uint32_t SYNCBUSY; } bit;
+};
+struct hostGclk { hostRegister GENDIV, GENCTRL, STATUS, CLKCTRL; };
+struct hostWdt { hostRegister CONFIG, STATUS, CTRL, CLEAR; };
+extern hostGclk hostGclkRegisters;
+extern hostWdt hostWdtRegisters;
+
+#define GCLK (&hostGclkRegisters)
+#define WDT (&hostWdtRegisters)
+#define GCLK_GENDIV_ID(x) (x)
+#define GCLK_GENDIV_DIV(x) ((x) << 8)
+#define GCLK_GENCTRL_ID(x) (x)
+#define GCLK_GENCTRL_GENEN 0
+#define GCLK_GENCTRL_SRC_OSCULP32K 0
+#define GCLK_GENCTRL_DIVSEL 0
+#define GCLK_CLKCTRL_ID_WDT 0
+#define GCLK_CLKCTRL_CLKEN 0
+#define GCLK_CLKCTRL_GEN_GCLK2 0
+#define WDT_CONFIG_PER_16K_Val 0xB
+#define WDT_CONFIG_PER(x) (x)
+#define WDT_CTRL_ENABLE 2
+#define WDT_CLEAR_CLEAR_KEY 0xA5
@@ -0,0 +1,30 @@
+/*
+
+    ArduinoRS485.h
+    https://github.com/RichardL64
+
+    Host stand in for the RS485 port, an open bus - nothing answers
+    Build with SIMULATE_INVERTER for the simulated inverters on the bus
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <Arduino.h>
+
+class RS485Class : public Stream {
+  public:
+    void begin(uint32_t baud) {}
+    void setDelays(int pre, int post) {}
+    void receive() {}
+    void noReceive() {}
+    void beginTransmission() {}
+    void endTransmission() {}
+    size_t write(uint8_t c) { return 1; }
+    using Print::write;
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+};
+extern RS485Class RS485;
@@ -0,0 +1,75 @@
+/*
+
+    Long32.h
+    https://github.com/RichardL64
+
+    The SAMD21's 32 bit long for the sketch, included by main after the other headers and before it
+    long becomes int, so unsigned long is 32 bits as well - millis() wraps, .2 registers combine
+    and writeLong prints as they do on the board. Nothing included after this may use long itself.
+
+    strtol/strtoul saturate at 32 bits as newlib's do, and the printf family takes %ld and %lu as
+    the ints they now are.
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <Arduino.h>
+
+static_assert(sizeof(int) == 4, "int stands in for the board's 32 bit long");
+
+inline int32_t hostStrtol(const char *s, char **end, int base) {
+  long value = strtol(s, end, base);
+  return value > INT32_MAX ? INT32_MAX : value < INT32_MIN ? INT32_MIN : value;
+}
+
+inline uint32_t hostStrtoul(const char *s, char **end, int base) {
+  unsigned long value = strtoul(s, end, base);
+  return value > UINT32_MAX && (long)value > 0 ? UINT32_MAX : value;     // negative wraps as on the board
+}
+
+//  The format with the l length modifier dropped from each conversion
+//
+inline const char *hostFormat(char (&f)[128], const char *format) {
+  size_t o = 0;
+  bool conversion = false;
+  for(const char *p = format; *p != '\0' && o < sizeof(f) -1; p++) {
+    if(conversion && *p == 'l') continue;
+    if(*p == '%') conversion = !conversion;
+    else if(conversion && strchr("diouxXcsp", *p) != 0) conversion = false;
+    f[o++] = *p;
+  }
+  f[o] = '\0';
+  return f;
+}
+
+inline int hostVsnprintf(char *s, size_t n, const char *format, va_list args) {
+  char f[128];
+  return vsnprintf(s, n, hostFormat(f, format), args);
+}
+
+inline int hostSnprintf(char *s, size_t n, const char *format, ...) {
+  char f[128];
+  va_list args;
+  va_start(args, format);
+  int l = vsnprintf(s, n, hostFormat(f, format), args);
+  va_end(args);
+  return l;
+}
+
+inline int hostPrintf(const char *format, ...) {
+  char f[128];
+  va_list args;
+  va_start(args, format);
+  int l = vprintf(hostFormat(f, format), args);
+  va_end(args);
+  return l;
+}
+
+#define strtol hostStrtol
+#define strtoul hostStrtoul
+#define vsnprintf hostVsnprintf
+#define snprintf hostSnprintf
+#define printf hostPrintf
+#define long int
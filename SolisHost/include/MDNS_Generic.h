@@ -0,0 +1,24 @@
+/*
+
+    MDNS_Generic.h
+    https://github.com/RichardL64
+
+    Host stand in for the mDNS responder, registrations are accepted and nothing is sent
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <WiFiNINA.h>
+
+#define MDNSServiceTCP 0
+
+class MDNS {
+  public:
+    MDNS(WiFiUDP &udp) {}
+    int begin(IPAddress address, const char *name) { return 1; }
+    int addServiceRecord(const char *name, uint16_t port, int protocol) { return 1; }
+    void removeAllServiceRecords() {}
+    void run() {}
+};
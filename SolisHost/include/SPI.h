@@ -0,0 +1,12 @@
+/*
+
+    SPI.h
+    https://github.com/RichardL64
+
+    Host stand in, nothing needed
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
@@ -0,0 +1,149 @@
+/*
+
+    WiFiNINA.h
+    https://github.com/RichardL64
+
+    Host stand in for the WiFiNINA library
+    Sockets are in memory byte queues, the harness writes requests in and reads responses out
+    Joining always succeeds, WiFiStorage files are kept in memory for the run
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <Arduino.h>
+#include <map>
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_CONNECT_FAILED 4
+#define WL_CONNECTION_LOST 5
+#define WL_DISCONNECTED 6
+#define WL_NO_MODULE 255
+#define WIFI_FIRMWARE_LATEST_VERSION "1.5.0"
+
+#define HOST_SOCKETS 10                       // as the NINA module
+#define HOST_NO_SOCKET 255
+
+//  One end of a TCP connection
+//
+struct hostSocket {
+    bool open;                                // client connected
+    std::string in;                           // bytes sent by the client, not yet read by the sketch
+    std::string out;                          // bytes written by the sketch, not yet read by the client
+};
+extern hostSocket hostSockets[HOST_SOCKETS];
+extern int hostWiFiStatus;
+
+class WiFiClient : public Stream {
+  public:
+    WiFiClient() : sock(HOST_NO_SOCKET) {}
+    WiFiClient(uint8_t sock) : sock(sock) {}
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t size) {
+      if(sock == HOST_NO_SOCKET || !hostSockets[sock].open) return 0;
+      hostSockets[sock].out.append((const char *)data, size);
+      return size;
+    }
+    using Print::write;
+    int availableForWrite() { return 4096; }
+
+    int available() { return sock == HOST_NO_SOCKET ? 0 : hostSockets[sock].in.size(); }
+    int read() {
+      uint8_t c;
+      return read(&c, 1) == 1 ? c : -1;
+    }
+    int read(uint8_t *data, size_t size) {
+      if(sock == HOST_NO_SOCKET) return -1;
+      std::string &in = hostSockets[sock].in;
+      size = min(size, in.size());
+      memcpy(data, in.data(), size);
+      in.erase(0, size);
+      return size;
+    }
+    int peek() { return available() ? (uint8_t)hostSockets[sock].in[0] : -1; }
+
+    uint8_t connected() { return sock != HOST_NO_SOCKET && (hostSockets[sock].open || available()); }
+    void stop() {
+      if(sock == HOST_NO_SOCKET) return;
+      hostSockets[sock].open = false;
+      hostSockets[sock].in.clear();
+    }
+    IPAddress remoteIP() { return IPAddress(127, 0, 0, 1); }
+    uint16_t remotePort() { return 50000 + sock; }
+
+    operator bool() { return sock != HOST_NO_SOCKET; }
+    bool operator==(const WiFiClient &other) const { return sock == other.sock; }
+    bool operator!=(const WiFiClient &other) const { return sock != other.sock; }
+
+  private:
+    uint8_t sock;
+};
+
+//  Hands out sockets with bytes waiting, taking turns as the NINA module does
+//
+class WiFiServer {
+  public:
+    WiFiServer(int port) : next(0) {}
+    void begin() {}
+    WiFiClient available() {
+      for(int n = 0; n < HOST_SOCKETS; n++) {
+        int s = (next + n) % HOST_SOCKETS;
+        if(hostSockets[s].in.empty()) continue;
+        next = s +1;
+        return WiFiClient(s);
+      }
+      return WiFiClient();
+    }
+  private:
+    int next;
+};
+
+class WiFiUDP {
+  public:
+    void stop() {}
+};
+
+class WiFiClass {
+  public:
+    String firmwareVersion() { return WIFI_FIRMWARE_LATEST_VERSION; }
+    int status() { return hostWiFiStatus; }
+    void setHostname(const char *name) {}
+    IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+    const char *SSID() { return "host"; }
+    int32_t RSSI() { return -50; }
+};
+extern WiFiClass WiFi;
+
+class WiFiStorageClass {
+  public:
+    bool exists(const char *name) { return files.count(name) != 0; }
+    bool exists(const char *name, uint32_t *size) {
+      if(!exists(name)) return false;
+      *size = files[name].size();
+      return true;
+    }
+    bool remove(const char *name) { return files.erase(name) != 0; }
+    bool rename(const char *from, const char *to) {
+      if(!exists(from)) return false;
+      files[to] = files[from];
+      files.erase(from);
+      return true;
+    }
+    bool read(const char *name, uint32_t offset, uint8_t *data, uint32_t length) {
+      if(!exists(name) || offset + length > files[name].size()) return false;
+      memcpy(data, files[name].data() + offset, length);
+      return true;
+    }
+    bool write(const char *name, uint32_t offset, uint8_t *data, uint32_t length) {
+      std::string &file = files[name];
+      if(file.size() < offset + length) file.resize(offset + length);
+      memcpy(&file[offset], data, length);
+      return true;
+    }
+  private:
+    std::map<std::string, std::string> files;
+};
+extern WiFiStorageClass WiFiStorage;
@@ -0,0 +1,13 @@
+/*
+
+    arduino_secrets.h
+    https://github.com/RichardL64
+
+    Host build network credentials, not used
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#define SECRET_SSID "host"
+#define SECRET_PASS ""
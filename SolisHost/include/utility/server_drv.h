@@ -0,0 +1,22 @@
+/*
+
+    utility/server_drv.h
+    https://github.com/RichardL64
+
+    Host stand in for the NINA socket driver, outbound connections aren't modelled - no socket is free
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <Arduino.h>
+
+#define NO_SOCKET_AVAIL 255
+#define TCP_MODE 0
+
+class ServerDrv {
+  public:
+    static uint8_t getSocket() { return NO_SOCKET_AVAIL; }
+    static void startClient(uint32_t ip, uint16_t port, uint8_t sock, uint8_t mode = TCP_MODE) {}
+};
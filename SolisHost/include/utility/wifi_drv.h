@@ -0,0 +1,21 @@
+/*
+
+    utility/wifi_drv.h
+    https://github.com/RichardL64
+
+    Host stand in for the NINA WiFi driver, a join is connected straight away
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#pragma once
+#include <WiFiNINA.h>
+
+class WiFiDrv {
+  public:
+    static int8_t wifiSetPassphrase(const char *ssid, uint8_t ssidLength, const char *passphrase, const uint8_t length) {
+      hostWiFiStatus = WL_CONNECTED;
+      return 1;
+    }
+};
@@ -0,0 +1,346 @@
+/*
+
+    main
+    https://github.com/RichardL64
+
+    Runs the SolisComms sketch on a Linux host against the simulated inverters
+
+      solis-host [seconds] [dashboards]     setup() then loop() for seconds, default 30, with N dashboards
+                                            requesting /R back to back over kept alive connections, default 4.
+                                            The Benchmark reports go to stdout as they would to serial
+      solis-host check                      end to end checks, exit status 1 if any fail
+
+    R.A.Lincoln       July 2022
+
+*/
+
+#include <Arduino.h>                          // the stand-ins first, with the host's own long
+#include <SPI.h>
+#include <WiFiNINA.h>
+#include <MDNS_Generic.h>
+#include <ArduinoRS485.h>
+#include <utility/server_drv.h>
+#include <utility/wifi_drv.h>
+#include <Long32.h>                           // then long is 32 bits, as on the board
+#include "sketch.cpp"                         // the .ino files joined by sketch.py
+
+static_assert(sizeof(long) == 4 && sizeof(unsigned long) == 4, "the sketch's long is the board's 32 bits");
+
+#define HOST_DASHBOARD "GET /R?address=33057.2,33035,33139,33149.2,33135 HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n"
+
+int hostFailures;
+
+//  Write a request on a socket, connecting it if it was closed
+//
+void hostSend(int s, const char *request) {
+  hostSocket &sock = hostSockets[s];
+  if(!sock.open) {
+    sock.open = true;
+    sock.out.clear();
+  }
+  sock.in += request;
+}
+
+//  Run the loop until the request on socket s has been read and answered, or timeout ms
+//  Returns the response, empty if there wasn't one
+//
+std::string hostAnswer(int s, unsigned long timeout = 2000) {
+  hostSocket &sock = hostSockets[s];
+  unsigned long start = millis();
+  while((!sock.in.empty() || sock.out.empty()) && millis() - start < timeout) loop();
+
+  std::string response = sock.out;
+  sock.out.clear();
+  return response;
+}
+
+std::string hostRequest(int s, const char *request) {
+  hostSend(s, request);
+  return hostAnswer(s);
+}
+
+//  Response body, after the header
+//
+std::string hostBody(const std::string &response) {
+  size_t end = response.find("\r\n\r\n");
+  return end == std::string::npos ? "" : response.substr(end + 4);
+}
+
+//  Run the loop for ms
+//
+void hostRun(unsigned long ms) {
+  unsigned long start = millis();
+  while(millis() - start < ms) loop();
+}
+
+void hostCheck(bool ok, const char *name) {
+  printf("%s %s\n", ok ? "ok  " : "FAIL", name);
+  if(!ok) hostFailures++;
+}
+
+//  One RTU read on its own, run to the end without the poll loop
+//  Returns the result, with the longest rtuService step in us
+//
+bool hostRtuGood;
+int hostRtuCount;
+word hostRtuValue;
+
+void hostRtuDone(bool good, const word *data, int count) {
+  hostRtuGood = good;
+  hostRtuCount = count;
+  hostRtuValue = good ? data[0] : 0;
+}
+
+bool hostRtu(byte id, int address, int count, unsigned long timeout, bool corrupt, unsigned long &longest) {
+  while(rtuBusy()) rtuService();
+  hostRtuCount = -1;
+  if(!rtuRead(id, address, count, timeout, hostRtuDone)) return false;
+  if(corrupt) simReply[3] ^= 0x01;                          // a bit flipped on the wire
+
+  longest = 0;
+  while(hostRtuCount == -1) {
+    unsigned long start = micros();
+    rtuService();
+    longest = max(longest, micros() - start);
+  }
+  return hostRtuGood;
+}
+
+//  ModbusRtu against the byte level simulated devices
+//
+void checkRtu() {
+  unsigned long longest, start;
+  hostCheck(hostRtu(1, 33139, 1, MODBUS_TIMEOUT, false, longest) && hostRtuCount == 1
+         && hostRtuValue == simRegister(33139), "RTU read");
+  hostCheck(longest < SIM_TURNAROUND * 1000UL, "RTU service never waits on the bus");   // host scheduling allowed for
+
+  hostCheck(!hostRtu(1, 33139, 2, MODBUS_TIMEOUT, true, longest), "RTU bad CRC refused");
+
+  start = millis();
+  hostCheck(!hostRtu(1, 34000, 1, MODBUS_TIMEOUT, false, longest) && millis() - start < MODBUS_TIMEOUT,
+            "RTU exception answered");
+
+  start = millis();
+  hostCheck(!hostRtu(9, 33139, 1, 200, false, longest) && millis() - start >= 200, "RTU missing device times out");
+
+  while(rtuBusy()) rtuService();
+  hostCheck(rtuRead(1, 33139, 1, MODBUS_TIMEOUT, hostRtuDone) && !rtuRead(1, 33139, 1, MODBUS_TIMEOUT, hostRtuDone),
+            "RTU busy refused");
+  while(rtuBusy()) rtuService();
+}
+
+//  Random request lines never take the parser outside the line
+//
+void checkParser() {
+  hostCheck(benchFuzz(BENCH_FUZZ) == 0, "request parser fuzz");
+}
+
+//  The simulated inverters read through the poll loop and served to a client
+//
+void checkEndToEnd() {
+  std::string response = hostRequest(0, HOST_DASHBOARD);
+  hostCheck(response.compare(0, 15, "HTTP/1.1 200 OK") == 0, "/R answered");
+
+  hostRun(5000);                                            // a few poll cycles
+  std::string body = hostBody(hostRequest(0, "GET /R?age=1&address=33139,33057.2 HTTP/1.1\r\n\r\n"));
+  hostCheck(body.find("\"data\":[") != std::string::npos && body.find("\"age\":[null") == std::string::npos
+         && body.find(",null]") == std::string::npos, "/R values read from the simulated inverter");
+
+  body = hostBody(hostRequest(0, "GET /R?a=33139,33057.2 HTTP/1.1\r\n\r\n"));      // as the Shelly SOC script asks
+  hostCheck(body.find("\"data\":[") != std::string::npos && body.find("\"data\":[null") == std::string::npos,
+            "/R single letter parameters");
+
+  body = hostBody(hostRequest(0, "GET /B?address=33139 HTTP/1.1\r\n\r\n"));
+  hostCheck(body.size() == 15 && body[14] == STATE_VALID, "/B value valid");
+
+  body = hostBody(hostRequest(0, "GET /R?address=33999 HTTP/1.1\r\n\r\n"));
+  hostRun(3000);
+  body = hostBody(hostRequest(0, "GET /R?since=0&address=33999 HTTP/1.1\r\n\r\n"));
+  hostCheck(body.find("\"33999\":null") != std::string::npos, "out of range register is null");
+
+  hostCheck(hostRequest(0, "GET /R?address=300:33057 HTTP/1.1\r\n\r\n").compare(0, 12, "HTTP/1.1 400") == 0
+         && hostRequest(0, "GET /B?a=0:33057 HTTP/1.1\r\n\r\n").compare(0, 12, "HTTP/1.1 400") == 0
+         && hostRequest(0, "GET /P?a=33057,70000 HTTP/1.1\r\n\r\n").compare(0, 12, "HTTP/1.1 400") == 0
+         && hostRequest(0, "GET /V?a=60001&e=r2:99999 HTTP/1.1\r\n\r\n").compare(0, 12, "HTTP/1.1 400") == 0
+         && hostRequest(0, "GET /R?address=247:33057 HTTP/1.1\r\n\r\n").compare(0, 12, "HTTP/1.1 200") == 0, "out of range device or address refused");
+  hostRequest(0, "GET /S?address=247:33057 HTTP/1.1\r\n\r\n");
+}
+
+//  The shipped rule has no host, so it never fires or pins its registers
+//
+void checkRules() {
+  hostRun(100);
+  std::string body = hostBody(hostRequest(0, "GET /C HTTP/1.1\r\n\r\n"));
+  size_t at = body.find("33139");
+  hostCheck(at != std::string::npos && body.find("pinned", at) > body.find('\n', at) && rules[0].state == RULE_UNKNOWN,
+            "rule without a host stays off");
+}
+
+//  Requests sent back to back on a kept connection are each answered
+//
+void checkPipelining() {
+  hostSend(1, "GET /B?address=33139 HTTP/1.1\r\n\r\nGET /B?address=33139 HTTP/1.1\r\n\r\nGET /S?address=1 HTTP/1.1\r\n\r\n");
+  hostRun(200);
+
+  std::string &out = hostSockets[1].out;
+  int responses = 0;
+  for(size_t at = out.find("HTTP/1.1 "); at != std::string::npos; at = out.find("HTTP/1.1 ", at +1)) responses++;
+  hostCheck(responses == 3, "pipelined requests answered");
+  out.clear();
+}
+
+//  Counter value from /metrics, -1 if missing
+//
+long hostMetric(const char *name) {
+  std::string body = hostBody(hostRequest(0, "GET /metrics HTTP/1.1\r\n\r\n"));
+  size_t at = body.find(std::string("\n") + name + " ");
+  return at == std::string::npos ? -1 : atol(body.c_str() + at + strlen(name) + 2);
+}
+
+//  Longest span read covering an address while running for ms
+//
+int hostSpan(int address, unsigned long ms) {
+  int longest = 0;
+  unsigned long start = millis();
+  while(millis() - start < ms) {
+    loop();
+    if(rtuBusy() && pollReading.start <= address && address < pollReading.start + pollReading.count) {
+      longest = max(longest, (int)pollReading.entries);
+    }
+  }
+  return longest;
+}
+
+//  A block read failing once reads its registers on their own, then joins them up again
+//
+void checkSpans() {
+  hostRequest(0, "GET /R?address=33135,33139,33147 HTTP/1.1\r\n\r\n");
+  hostCheck(hostSpan(33139, 5000) > 1, "neighbouring registers read in one span");
+
+  simFail = 33139;
+  int i = cacheFind(33139);
+  unsigned long start = millis();
+  while(!(regCache[i].flags & REG_SOLO) && millis() - start < 5000) loop();
+  hostCheck(simFail == 0 && (regCache[i].flags & REG_SOLO), "failed span read on its own");
+
+  hostCheck(hostSpan(33139, 8000) > 1 && !(regCache[i].flags & REG_SOLO), "span joined again after good reads");
+}
+
+//  Long bodies chunked only on kept HTTP/1.1 connections, otherwise ended by the close
+//
+void checkFraming() {
+  std::string response = hostRequest(2, "GET /metrics HTTP/1.1\r\n\r\n");
+  hostCheck(response.size() > HTTP_PRINT_CHUNK && response.find("Transfer-Encoding: chunked") != std::string::npos
+         && hostSockets[2].open, "long body chunked on a kept connection");
+
+  response = hostRequest(2, "GET /metrics HTTP/1.0\r\n\r\n");
+  hostCheck(response.compare(0, 15, "HTTP/1.0 200 OK") == 0 && response.find("Transfer-Encoding") == std::string::npos
+         && response.find("Connection: close") != std::string::npos && !hostSockets[2].open, "HTTP/1.0 long body ended by the close");
+
+  response = hostRequest(2, "GET /metrics HTTP/1.1\r\nConnection: close\r\n\r\n");
+  hostCheck(response.find("Transfer-Encoding") == std::string::npos && !hostSockets[2].open, "closing long body not chunked");
+}
+
+//  Response times counted against the route that answered
+//
+void checkMetrics() {
+  hostRequest(0, "GET /L HTTP/1.1\r\n\r\n");
+  hostRequest(0, "GET /nothing HTTP/1.1\r\n\r\n");
+  std::string body = hostBody(hostRequest(0, "GET /metrics HTTP/1.1\r\n\r\n"));
+  hostCheck(body.find("solis_http_request_seconds_count{route=\"/L\"} 1\n") != std::string::npos
+         && body.find("solis_http_request_seconds_count{route=\"other\"} 1\n") != std::string::npos, "/metrics by route");
+
+  long lookups = hostMetric("solis_cache_hits_total") + hostMetric("solis_cache_misses_total");
+  hostRequest(0, "GET /B?address=33139,33057 HTTP/1.1\r\n\r\n");
+  hostCheck(hostMetric("solis_cache_hits_total") + hostMetric("solis_cache_misses_total") == lookups + 2, "/B counts one lookup per address");
+}
+
+//  Worst case 32 bit points never overrun the 5 minute ring, and read back as stored
+//
+void checkHistoryRing() {
+  int h = historySlot(33998);
+  historyTier &tier = histCache[h].tier[FIVE_MINUTE];
+  const int points = 300;
+  long mean[points], low[points], high[points];
+  for(int p = 0; p < points; p++) {
+    mean[p] = p % 2 ? 0x40000000L : 0;                      // every field a 5 byte varint
+    low[p] = -0x7FFFFFFFL -1;
+    high[p] = 0x7FFFFFFFL;
+    historyStore(h, FIVE_MINUTE, mean[p], low[p], high[p]);
+  }
+
+  bool same = tier.used <= HISTORY_MINUTE_BYTES && tier.points >= HISTORY_MINUTE_BYTES / HISTORY_POINT_MAX;
+  word pos = tier.first;
+  long m = tier.base;
+  for(int p = points - tier.points; p < points; p++) {
+    m = (unsigned long)m + historyUnzigzag(historyDecode(h, FIVE_MINUTE, pos));
+    long l = (unsigned long)m - historyDecode(h, FIVE_MINUTE, pos);
+    long g = (unsigned long)m + historyDecode(h, FIVE_MINUTE, pos);
+    if(m != mean[p] || l != low[p] || g != high[p]) same = false;
+  }
+  hostCheck(same, "worst case history points kept whole");
+  memset(&histCache[h], 0, sizeof(histCache[h]));
+}
+
+//  Kept registers are pinned in the register cache, not counted as client lookups
+//
+void checkHistory() {
+  hostRequest(0, "GET /H?m=5&a=33057 HTTP/1.1\r\n\r\n");              // single letter parameters
+  hostRun(100);
+  std::string body = hostBody(hostRequest(0, "GET /C HTTP/1.1\r\n\r\n"));
+  size_t at = body.find("33057");
+  hostCheck(at != std::string::npos && body.find("pinned", at) < body.find('\n', at), "kept register pinned");
+
+  long hits = hostMetric("solis_cache_hits_total");
+  hostRun(2000);
+  hostCheck(hits >= 0 && hostMetric("solis_cache_hits_total") == hits, "kept registers not counted as cache hits");
+}
+
+int check() {
+  checkRtu();
+  checkParser();
+  setup();
+  checkEndToEnd();
+  checkRules();
+  checkPipelining();
+  checkMetrics();
+  checkFraming();
+  checkSpans();
+  checkHistory();
+  checkHistoryRing();
+
+  printf(hostFailures == 0 ? "All checks passed\n" : "%d checks failed\n", hostFailures);
+  return hostFailures == 0 ? 0 : 1;
+}
+
+//  Load with dashboards each requesting /R again as soon as the last one is answered
+//
+int run(unsigned long seconds, int dashboards) {
+  setup();
+
+  unsigned long responses = 0;
+  unsigned long start = millis();
+  while(millis() - start < seconds * 1000) {
+    for(int d = 0; d < dashboards; d++) {
+      hostSocket &sock = hostSockets[d];
+      if(sock.in.empty() && !sock.out.empty()) {            // answered
+        sock.out.clear();
+        responses++;
+      }
+      if(sock.in.empty() && sock.out.empty()) hostSend(d, HOST_DASHBOARD);
+    }
+    loop();
+  }
+  benchReport();
+  printf("Dashboards %d, responses %lu in %lus\n", dashboards, responses, seconds);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  setvbuf(stdout, 0, _IOLBF, 0);
+  if(argc > 1 && strcmp(argv[1], "check") == 0) return check();
+
+  unsigned long seconds = argc > 1 ? strtoul(argv[1], 0, 10) : 30;
+  int dashboards = argc > 2 ? atoi(argv[2]) : 4;
+  return run(seconds, min(dashboards, HOST_SOCKETS));
+}
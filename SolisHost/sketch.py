@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+#
+#   sketch.py
+#   https://github.com/RichardL64
+#
+#   Join the SolisComms .ino files into one C++ file the way the Arduino IDE does:
+#   SolisComms.ino first then the rest alphabetically, with a prototype for every function
+#   inserted before the first definition so any file can call any other
+#
+#     python3 sketch.py <sketch folder> <output.cpp>
+#
+#   Like the IDE, functions with default arguments need their prototype in a .h
+#
+#   R.A.Lincoln       July 2022
+#
+import os, re, sys
+
+folder, target = sys.argv[1], sys.argv[2]
+main = os.path.basename(os.path.abspath(folder)) + '.ino'
+files = [main] + sorted((f for f in os.listdir(folder) if f.endswith('.ino') and f != main), key=str.lower)
+
+text = ''
+for f in files:
+    path = os.path.abspath(os.path.join(folder, f))
+    text += '#line 1 "%s"\n' % path + open(path).read() + '\n'
+
+#   Blank out comments, strings, chars and preprocessor lines so braces and parentheses can be counted,
+#   keeping every other char where it was
+#
+def blank(match):
+    return re.sub(r'[^\n]', ' ', match.group(0))
+
+code = re.sub(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'', blank, text, flags=re.S)
+code = re.sub(r'(?m)^[ \t]*#.*$', blank, code)
+
+#   Top level function definitions - a ) then { outside any braces, and not a struct, class or initialiser
+#
+prototypes, first = [], None
+depth, start = 0, 0
+for i, c in enumerate(code):
+    if c == '{':
+        head = code[start:i].strip()
+        if depth == 0 and head.endswith(')') and '=' not in head.split('(')[0] \
+           and not re.match(r'(struct|class|union|enum|namespace|extern)\b', head):
+            name = re.search(r'(\w+)\s*\(', head).group(1)
+            if name not in ('if', 'for', 'while', 'switch'):
+                prototypes.append(' '.join(head.split()) + ';')
+                if first is None: first = start
+        depth += 1
+    elif c == '}':
+        depth -= 1
+        if depth == 0: start = i +1
+    elif c == ';' and depth == 0:
+        start = i +1
+
+#   Prototypes go on their own lines before the first definition, then the line numbering carries on
+#
+first += len(code[first:]) - len(code[first:].lstrip())
+line = text.rfind('\n', 0, first) +1
+source = text[:line].rfind('#line 1 "')
+name = text[source + 9:text.index('"', source + 9)]
+number = text.count('\n', source, line)
+
+with open(target, 'w') as out:
+    out.write('#include <Arduino.h>\n')
+    out.write(text[:line])
+    out.write('\n'.join(prototypes) + '\n')
+    out.write('#line %d "%s"\n' % (number, name))
+    out.write(text[line:])